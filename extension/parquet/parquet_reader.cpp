@@ -26,6 +26,7 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -940,6 +941,25 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterBloom(Vector &v, const BlockedBloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	// only probe the rows that are still selected - the other rows might not have been read
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	auto result_count = bloom_filter.Lookup(v, sel, sel_count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < result_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -966,6 +986,9 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		case ExpressionType::COMPARE_EQUAL:
 			FilterOperationSwitch<Equals>(v, constant_filter.constant, filter_mask, count);
 			break;
+		case ExpressionType::COMPARE_NOTEQUAL:
+			FilterOperationSwitch<NotEquals>(v, constant_filter.constant, filter_mask, count);
+			break;
 		case ExpressionType::COMPARE_LESSTHAN:
 			FilterOperationSwitch<LessThan>(v, constant_filter.constant, filter_mask, count);
 			break;
@@ -994,6 +1017,11 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		FilterBloom(v, *bloom_filter.filter, filter_mask, count);
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -78,6 +78,7 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/core_functions/aggregate/quantile_enum.hpp"
+#include "duckdb/core_functions/aggregate/sketch_state.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_option.hpp"
@@ -4445,6 +4446,8 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPTIMIZER_COMPRESSED_MATERIALIZATION";
 	case MetricsType::OPTIMIZER_DUPLICATE_GROUPS:
 		return "OPTIMIZER_DUPLICATE_GROUPS";
+	case MetricsType::OPTIMIZER_GROUPING_SETS:
+		return "OPTIMIZER_GROUPING_SETS";
 	case MetricsType::OPTIMIZER_REORDER_FILTER:
 		return "OPTIMIZER_REORDER_FILTER";
 	case MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN:
@@ -4574,6 +4577,9 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPTIMIZER_DUPLICATE_GROUPS")) {
 		return MetricsType::OPTIMIZER_DUPLICATE_GROUPS;
 	}
+	if (StringUtil::Equals(value, "OPTIMIZER_GROUPING_SETS")) {
+		return MetricsType::OPTIMIZER_GROUPING_SETS;
+	}
 	if (StringUtil::Equals(value, "OPTIMIZER_REORDER_FILTER")) {
 		return MetricsType::OPTIMIZER_REORDER_FILTER;
 	}
@@ -4873,6 +4879,8 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "COMPRESSED_MATERIALIZATION";
 	case OptimizerType::DUPLICATE_GROUPS:
 		return "DUPLICATE_GROUPS";
+	case OptimizerType::GROUPING_SETS:
+		return "GROUPING_SETS";
 	case OptimizerType::REORDER_FILTER:
 		return "REORDER_FILTER";
 	case OptimizerType::JOIN_FILTER_PUSHDOWN:
@@ -4948,6 +4956,9 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "DUPLICATE_GROUPS")) {
 		return OptimizerType::DUPLICATE_GROUPS;
 	}
+	if (StringUtil::Equals(value, "GROUPING_SETS")) {
+		return OptimizerType::GROUPING_SETS;
+	}
 	if (StringUtil::Equals(value, "REORDER_FILTER")) {
 		return OptimizerType::REORDER_FILTER;
 	}
@@ -5368,6 +5379,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -5542,6 +5555,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -6795,6 +6811,34 @@ SinkResultType EnumUtil::FromString<SinkResultType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<SketchType>(SketchType value) {
+	switch(value) {
+	case SketchType::TDIGEST:
+		return "TDIGEST";
+	case SketchType::HYPERLOGLOG:
+		return "HYPERLOGLOG";
+	case SketchType::SPACE_SAVING:
+		return "SPACE_SAVING";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+SketchType EnumUtil::FromString<SketchType>(const char *value) {
+	if (StringUtil::Equals(value, "TDIGEST")) {
+		return SketchType::TDIGEST;
+	}
+	if (StringUtil::Equals(value, "HYPERLOGLOG")) {
+		return SketchType::HYPERLOGLOG;
+	}
+	if (StringUtil::Equals(value, "SPACE_SAVING")) {
+		return SketchType::SPACE_SAVING;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<SourceResultType>(SourceResultType value) {
 	switch(value) {
@@ -7412,6 +7456,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -7437,6 +7483,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
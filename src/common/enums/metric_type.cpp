@@ -32,6 +32,7 @@ profiler_settings_t MetricsUtils::GetOptimizerMetrics() {
         MetricsType::OPTIMIZER_TOP_N,
         MetricsType::OPTIMIZER_COMPRESSED_MATERIALIZATION,
         MetricsType::OPTIMIZER_DUPLICATE_GROUPS,
+        MetricsType::OPTIMIZER_GROUPING_SETS,
         MetricsType::OPTIMIZER_REORDER_FILTER,
         MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN,
         MetricsType::OPTIMIZER_EXTENSION,
@@ -92,6 +93,8 @@ MetricsType MetricsUtils::GetOptimizerMetricByType(OptimizerType type) {
             return MetricsType::OPTIMIZER_COMPRESSED_MATERIALIZATION;
         case OptimizerType::DUPLICATE_GROUPS:
             return MetricsType::OPTIMIZER_DUPLICATE_GROUPS;
+        case OptimizerType::GROUPING_SETS:
+            return MetricsType::OPTIMIZER_GROUPING_SETS;
         case OptimizerType::REORDER_FILTER:
             return MetricsType::OPTIMIZER_REORDER_FILTER;
         case OptimizerType::JOIN_FILTER_PUSHDOWN:
@@ -145,6 +148,8 @@ OptimizerType MetricsUtils::GetOptimizerTypeByMetric(MetricsType type) {
             return OptimizerType::COMPRESSED_MATERIALIZATION;
         case MetricsType::OPTIMIZER_DUPLICATE_GROUPS:
             return OptimizerType::DUPLICATE_GROUPS;
+        case MetricsType::OPTIMIZER_GROUPING_SETS:
+            return OptimizerType::GROUPING_SETS;
         case MetricsType::OPTIMIZER_REORDER_FILTER:
             return OptimizerType::REORDER_FILTER;
         case MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN:
@@ -179,6 +184,7 @@ bool MetricsUtils::IsOptimizerMetric(MetricsType type) {
         case MetricsType::OPTIMIZER_TOP_N:
         case MetricsType::OPTIMIZER_COMPRESSED_MATERIALIZATION:
         case MetricsType::OPTIMIZER_DUPLICATE_GROUPS:
+        case MetricsType::OPTIMIZER_GROUPING_SETS:
         case MetricsType::OPTIMIZER_REORDER_FILTER:
         case MetricsType::OPTIMIZER_JOIN_FILTER_PUSHDOWN:
         case MetricsType::OPTIMIZER_EXTENSION:
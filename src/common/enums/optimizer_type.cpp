@@ -31,6 +31,7 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"build_side_probe_side", OptimizerType::BUILD_SIDE_PROBE_SIDE},
     {"compressed_materialization", OptimizerType::COMPRESSED_MATERIALIZATION},
     {"duplicate_groups", OptimizerType::DUPLICATE_GROUPS},
+    {"grouping_sets", OptimizerType::GROUPING_SETS},
     {"reorder_filter", OptimizerType::REORDER_FILTER},
     {"join_filter_pushdown", OptimizerType::JOIN_FILTER_PUSHDOWN},
     {"extension", OptimizerType::EXTENSION},
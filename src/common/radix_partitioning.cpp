@@ -2,7 +2,6 @@
 
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/types/vector.hpp"
-#include "duckdb/common/vector_operations/binary_executor.hpp"
 #include "duckdb/common/vector_operations/unary_executor.hpp"
 
 namespace duckdb {
@@ -60,27 +59,40 @@ RETURN_TYPE RadixBitsSwitch(const idx_t radix_bits, ARGS &&... args) {
 	} // LCOV_EXCL_STOP
 }
 
-template <idx_t radix_bits>
-struct RadixLessThan {
-	static inline bool Operation(hash_t hash, hash_t cutoff) {
-		using CONSTANTS = RadixPartitioningConstants<radix_bits>;
-		return CONSTANTS::ApplyMask(hash) < cutoff;
-	}
-};
-
 struct SelectFunctor {
 	template <idx_t radix_bits>
-	static idx_t Operation(Vector &hashes, const SelectionVector *sel, const idx_t count, const idx_t cutoff,
-	                       SelectionVector *true_sel, SelectionVector *false_sel) {
-		Vector cutoff_vector(Value::HASH(cutoff));
-		return BinaryExecutor::Select<hash_t, hash_t, RadixLessThan<radix_bits>>(hashes, cutoff_vector, sel, count,
-		                                                                         true_sel, false_sel);
+	static idx_t Operation(Vector &hashes, const SelectionVector *sel, const idx_t count,
+	                       const ValidityMask &partition_mask, SelectionVector *true_sel, SelectionVector *false_sel) {
+		using CONSTANTS = RadixPartitioningConstants<radix_bits>;
+		UnifiedVectorFormat hdata;
+		hashes.ToUnifiedFormat(count, hdata);
+		const auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+		idx_t true_count = 0;
+		idx_t false_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			const auto idx = sel ? sel->get_index(i) : i;
+			const auto partition_idx = CONSTANTS::ApplyMask(hash_data[hdata.sel->get_index(idx)]);
+			if (partition_mask.RowIsValidUnsafe(partition_idx)) {
+				if (true_sel) {
+					true_sel->set_index(true_count, idx);
+				}
+				true_count++;
+			} else {
+				if (false_sel) {
+					false_sel->set_index(false_count, idx);
+				}
+				false_count++;
+			}
+		}
+		return true_count;
 	}
 };
 
 idx_t RadixPartitioning::Select(Vector &hashes, const SelectionVector *sel, const idx_t count, const idx_t radix_bits,
-                                const idx_t cutoff, SelectionVector *true_sel, SelectionVector *false_sel) {
-	return RadixBitsSwitch<SelectFunctor, idx_t>(radix_bits, hashes, sel, count, cutoff, true_sel, false_sel);
+                                const ValidityMask &partition_mask, SelectionVector *true_sel,
+                                SelectionVector *false_sel) {
+	return RadixBitsSwitch<SelectFunctor, idx_t>(radix_bits, hashes, sel, count, partition_mask, true_sel, false_sel);
 }
 
 struct ComputePartitionIndicesFunctor {
@@ -0,0 +1,78 @@
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+BlockedBloomFilter::BlockedBloomFilter(idx_t expected_count) {
+	auto block_count = NextPowerOfTwo(MaxValue<idx_t>(expected_count * BITS_PER_ELEMENT / 64, 1));
+	blocks.resize(block_count, 0);
+	block_mask = block_count - 1;
+}
+
+BlockedBloomFilter::BlockedBloomFilter(vector<uint64_t> blocks_p) : blocks(std::move(blocks_p)) {
+	D_ASSERT(IsPowerOfTwo(blocks.size()));
+	block_mask = blocks.size() - 1;
+}
+
+void BlockedBloomFilter::Insert(Vector &input, idx_t count) {
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, count);
+
+	UnifiedVectorFormat idata;
+	input.ToUnifiedFormat(count, idata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!idata.validity.RowIsValid(idata.sel->get_index(i))) {
+			// NULL values never match: no need to insert them
+			continue;
+		}
+		InsertHash(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+idx_t BlockedBloomFilter::Lookup(Vector &input, SelectionVector &sel, idx_t approved_tuple_count) const {
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(input, hashes, sel, approved_tuple_count);
+
+	UnifiedVectorFormat idata;
+	input.ToUnifiedFormat(approved_tuple_count, idata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(approved_tuple_count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!idata.validity.RowIsValid(idata.sel->get_index(idx))) {
+			continue;
+		}
+		if (LookupHash(hash_data[hdata.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+void BlockedBloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty<idx_t>(100, "block_count", blocks.size());
+	serializer.WriteProperty(101, "blocks", const_data_ptr_cast(blocks.data()), SizeInBytes());
+}
+
+shared_ptr<BlockedBloomFilter> BlockedBloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(100, "block_count");
+	if (block_count == 0 || !IsPowerOfTwo(block_count)) {
+		throw SerializationException("Invalid block count for BlockedBloomFilter");
+	}
+	vector<uint64_t> blocks(block_count, 0);
+	deserializer.ReadProperty(101, "blocks", data_ptr_cast(blocks.data()), block_count * sizeof(uint64_t));
+	return make_shared_ptr<BlockedBloomFilter>(std::move(blocks));
+}
+
+} // namespace duckdb
@@ -2,6 +2,7 @@
 
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/fsst.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
@@ -231,8 +232,13 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		// already a dictionary, slice the current dictionary
 		auto &current_sel = DictionaryVector::SelVector(*this);
+		const auto dictionary_size = DictionaryVector::DictionarySize(*this);
+		const auto dictionary_id = DictionaryVector::DictionaryId(*this);
 		auto sliced_dictionary = current_sel.Slice(sel, count);
 		buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		if (dictionary_size.IsValid()) {
+			DictionaryVector::SetDictionary(*this, dictionary_size.GetIndex(), dictionary_id);
+		}
 		if (GetType().InternalType() == PhysicalType::STRUCT) {
 			auto &child_vector = DictionaryVector::Child(*this);
 
@@ -269,8 +275,13 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 		auto entry = cache.cache.find(target_data);
 		if (entry != cache.cache.end()) {
 			// cached entry exists: use that
+			const auto dictionary_size = DictionaryVector::DictionarySize(*this);
+			const auto dictionary_id = DictionaryVector::DictionaryId(*this);
 			this->buffer = make_buffer<DictionaryBuffer>(entry->second->Cast<DictionaryBuffer>().GetSelVector());
 			vector_type = VectorType::DICTIONARY_VECTOR;
+			if (dictionary_size.IsValid()) {
+				DictionaryVector::SetDictionary(*this, dictionary_size.GetIndex(), dictionary_id);
+			}
 		} else {
 			Slice(sel, count);
 			cache.cache[target_data] = this->buffer;
@@ -1742,6 +1753,21 @@ void Vector::DebugShuffleNestedVector(Vector &vector, idx_t count) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// DictionaryVector
+//===--------------------------------------------------------------------===//
+void DictionaryVector::SetDictionary(Vector &vector, idx_t dictionary_size, idx_t dictionary_id) {
+	D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+	auto &dict_buffer = vector.buffer->Cast<DictionaryBuffer>();
+	dict_buffer.SetDictionarySize(dictionary_size);
+	dict_buffer.SetDictionaryId(dictionary_id);
+}
+
+idx_t DictionaryVector::CreateDictionaryId() {
+	static atomic<idx_t> next_dictionary_id {1};
+	return next_dictionary_id++;
+}
+
 //===--------------------------------------------------------------------===//
 // FlatVector
 //===--------------------------------------------------------------------===//
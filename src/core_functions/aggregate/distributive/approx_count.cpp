@@ -2,6 +2,7 @@
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
+#include "duckdb/core_functions/aggregate/sketch_state.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "hyperloglog.hpp"
@@ -96,4 +97,52 @@ AggregateFunction ApproxCountDistinctFun::GetFunction() {
 	return GetApproxCountDistinctFunction(LogicalType::ANY);
 }
 
+//===--------------------------------------------------------------------===//
+// approx_count_distinct_state / approx_count_distinct_merge
+//===--------------------------------------------------------------------===//
+struct ApproxCountDistinctStateFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		MemoryStream stream;
+		SketchState::WriteHeader(stream, SketchType::HYPERLOGLOG);
+		for (idx_t i = 0; i < HyperLogLog::M; i++) {
+			stream.Write<uint8_t>(state.hll.GetRegister(i));
+		}
+		target = SketchState::AddBlob(finalize_data.result, stream);
+	}
+};
+
+struct ApproxCountDistinctMergeFunction : public ApproxCountDistinctFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const string_t &input, AggregateUnaryInput &) {
+		auto stream = SketchState::ReadHeader(input, SketchType::HYPERLOGLOG, "approx_count_distinct");
+		for (idx_t i = 0; i < HyperLogLog::M; i++) {
+			const auto z = stream.Read<uint8_t>();
+			if (z > HyperLogLog::Q + 1) {
+				throw InvalidInputException("Invalid input for approx_count_distinct: corrupt state");
+			}
+			state.hll.Update(i, z);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input, idx_t) {
+		// merging a sketch is idempotent
+		Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+AggregateFunction ApproxCountDistinctStateFun::GetFunction() {
+	auto fun = GetApproxCountDistinctFunction(LogicalType::ANY);
+	fun.name = "approx_count_distinct_state";
+	fun.return_type = LogicalType::BLOB;
+	fun.finalize = AggregateFunction::StateFinalize<ApproxDistinctCountState, string_t, ApproxCountDistinctStateFunction>;
+	return fun;
+}
+
+AggregateFunction ApproxCountDistinctMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregate<ApproxDistinctCountState, string_t, int64_t,
+	                                         ApproxCountDistinctMergeFunction>(LogicalType::BLOB, LogicalType::BIGINT);
+}
+
 } // namespace duckdb
@@ -1,7 +1,9 @@
 #include "duckdb/core_functions/aggregate/histogram_helpers.hpp"
 #include "duckdb/core_functions/aggregate/holistic_functions.hpp"
+#include "duckdb/core_functions/aggregate/sketch_state.hpp"
 #include "duckdb/core_functions/aggregate/sort_key_helpers.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/common/string_map_set.hpp"
 #include "duckdb/common/printer.hpp"
 
@@ -385,4 +387,115 @@ AggregateFunction ApproxTopKFun::GetFunction() {
 	                         AggregateFunction::StateDestroy<STATE, OP>);
 }
 
+//===--------------------------------------------------------------------===//
+// approx_top_k_state / approx_top_k_merge
+//===--------------------------------------------------------------------===//
+static void ApproxTopKStateFinalize(Vector &state_vector, AggregateInputData &, Vector &result, idx_t count,
+                                    idx_t offset) {
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto states = UnifiedVectorFormat::GetData<ApproxTopKState *>(sdata);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &mask = FlatVector::Validity(result);
+
+	MemoryStream stream;
+	for (idx_t i = 0; i < count; i++) {
+		const auto rid = i + offset;
+		auto &state = *states[sdata.sel->get_index(i)];
+		if (state.values.empty()) {
+			mask.SetInvalid(rid);
+			continue;
+		}
+		// the monitored values are sorted on their count, so they can be re-inserted in order when merging
+		stream.Rewind();
+		SketchState::WriteHeader(stream, SketchType::SPACE_SAVING);
+		stream.Write<uint64_t>(state.k);
+		stream.Write<uint32_t>(UnsafeNumericCast<uint32_t>(state.values.size()));
+		for (auto &entry : state.values) {
+			auto &val = entry.get();
+			auto size = UnsafeNumericCast<uint32_t>(val.str_val.str.GetSize());
+			stream.Write<uint64_t>(val.count);
+			stream.Write<uint32_t>(size);
+			stream.WriteData(const_data_ptr_cast(val.str_val.str.GetData()), size);
+		}
+		result_data[rid] = SketchState::AddBlob(result, stream);
+	}
+}
+
+static void ApproxTopKMergeUpdate(Vector inputs[], AggregateInputData &aggr_input, idx_t input_count,
+                                  Vector &state_vector, idx_t count) {
+	using STATE = ApproxTopKState;
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	UnifiedVectorFormat input_data;
+	inputs[0].ToUnifiedFormat(count, input_data);
+
+	auto states = UnifiedVectorFormat::GetData<STATE *>(sdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(input_data);
+	string buffer;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (!input_data.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto stream = SketchState::ReadHeader(data[idx], SketchType::SPACE_SAVING, "approx_top_k");
+		auto k = stream.Read<uint64_t>();
+		auto value_count = stream.Read<uint32_t>();
+		if (k == 0 || value_count == 0) {
+			throw InvalidInputException("Invalid input for approx_top_k: corrupt state");
+		}
+
+		// rebuild the state of the sketch, and combine it with the state of the group
+		STATE source;
+		source.Initialize(k);
+		if (value_count > source.capacity) {
+			throw InvalidInputException("Invalid input for approx_top_k: corrupt state");
+		}
+		for (uint32_t value_idx = 0; value_idx < value_count; value_idx++) {
+			auto frequency = stream.Read<uint64_t>();
+			auto size = stream.Read<uint32_t>();
+			if (frequency == 0 || stream.GetPosition() + size > stream.GetCapacity()) {
+				throw InvalidInputException("Invalid input for approx_top_k: corrupt state");
+			}
+			buffer.resize(size);
+			stream.ReadData(data_ptr_cast(&buffer[0]), size);
+			string_t str(buffer.data(), size);
+			source.InsertOrReplaceEntry(ApproxTopKString(str, Hash(str)), aggr_input, frequency);
+		}
+		ApproxTopKOperation::Combine<STATE, ApproxTopKOperation>(source, *states[sdata.sel->get_index(i)],
+		                                                          aggr_input);
+	}
+}
+
+unique_ptr<FunctionData> ApproxTopKStateBind(ClientContext &context, AggregateFunction &function,
+                                             vector<unique_ptr<Expression>> &arguments) {
+	if (arguments[0]->return_type.id() == LogicalTypeId::UNKNOWN) {
+		throw ParameterNotResolvedException();
+	}
+	// the values are stored in the sketch as strings, so the merged values do not depend on the input type
+	arguments[0] = BoundCastExpression::AddCastToType(context, std::move(arguments[0]), LogicalType::VARCHAR);
+	function.arguments[0] = LogicalType::VARCHAR;
+	return nullptr;
+}
+
+AggregateFunction ApproxTopKStateFun::GetFunction() {
+	using STATE = ApproxTopKState;
+	using OP = ApproxTopKOperation;
+	return AggregateFunction("approx_top_k_state", {LogicalTypeId::ANY, LogicalType::BIGINT}, LogicalType::BLOB,
+	                         AggregateFunction::StateSize<STATE>, AggregateFunction::StateInitialize<STATE, OP>,
+	                         ApproxTopKUpdate<string_t, HistogramStringFunctor>,
+	                         AggregateFunction::StateCombine<STATE, OP>, ApproxTopKStateFinalize, nullptr,
+	                         ApproxTopKStateBind, AggregateFunction::StateDestroy<STATE, OP>);
+}
+
+AggregateFunction ApproxTopKMergeFun::GetFunction() {
+	using STATE = ApproxTopKState;
+	using OP = ApproxTopKOperation;
+	return AggregateFunction("approx_top_k_merge", {LogicalType::BLOB}, LogicalType::LIST(LogicalType::VARCHAR),
+	                         AggregateFunction::StateSize<STATE>, AggregateFunction::StateInitialize<STATE, OP>,
+	                         ApproxTopKMergeUpdate, AggregateFunction::StateCombine<STATE, OP>,
+	                         ApproxTopKFinalize<HistogramStringFunctor>, nullptr, nullptr,
+	                         AggregateFunction::StateDestroy<STATE, OP>);
+}
+
 } // namespace duckdb
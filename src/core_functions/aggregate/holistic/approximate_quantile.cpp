@@ -1,5 +1,6 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/core_functions/aggregate/holistic_functions.hpp"
+#include "duckdb/core_functions/aggregate/sketch_state.hpp"
 #include "t_digest.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
@@ -365,6 +366,94 @@ AggregateFunction GetApproxQuantileListAggregate(const LogicalType &type) {
 	return fun;
 }
 
+//===--------------------------------------------------------------------===//
+// approx_quantile_state / approx_quantile_merge
+//===--------------------------------------------------------------------===//
+struct ApproxQuantileStateOperation : public ApproxQuantileOperation {
+	template <class TARGET_TYPE, class STATE>
+	static void Finalize(STATE &state, TARGET_TYPE &target, AggregateFinalizeData &finalize_data) {
+		if (state.pos == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		D_ASSERT(state.h);
+		state.h->compress();
+		auto &centroids = state.h->processed();
+
+		MemoryStream stream;
+		SketchState::WriteHeader(stream, SketchType::TDIGEST);
+		stream.Write<uint64_t>(state.pos);
+		stream.Write<uint32_t>(UnsafeNumericCast<uint32_t>(centroids.size()));
+		for (auto &centroid : centroids) {
+			stream.Write<double>(centroid.mean());
+			stream.Write<double>(centroid.weight());
+		}
+		target = SketchState::AddBlob(finalize_data.result, stream);
+	}
+};
+
+template <class OP>
+struct ApproxQuantileMergeOperation : public OP {
+	template <class INPUT_TYPE, class STATE, class>
+	static void Operation(STATE &state, const string_t &input, AggregateUnaryInput &) {
+		auto stream = SketchState::ReadHeader(input, SketchType::TDIGEST, "approx_quantile");
+		auto count = stream.Read<uint64_t>();
+		auto centroid_count = stream.Read<uint32_t>();
+		if (count == 0) {
+			return;
+		}
+		if (!state.h) {
+			state.h = new duckdb_tdigest::TDigest(100);
+		}
+		for (uint32_t i = 0; i < centroid_count; i++) {
+			auto mean = stream.Read<double>();
+			auto weight = stream.Read<double>();
+			state.h->add(mean, weight);
+		}
+		state.pos += count;
+	}
+
+	template <class INPUT_TYPE, class STATE, class>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+};
+
+AggregateFunction ApproxQuantileStateFun::GetFunction() {
+	auto fun = AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t,
+	                                                       ApproxQuantileStateOperation>(LogicalType::DOUBLE,
+	                                                                                     LogicalType::BLOB);
+	fun.name = "approx_quantile_state";
+	return fun;
+}
+
+AggregateFunctionSet ApproxQuantileMergeFun::GetFunctions() {
+	AggregateFunctionSet approx_quantile_merge;
+
+	auto fun = AggregateFunction::UnaryAggregateDestructor<
+	    ApproxQuantileState, string_t, double, ApproxQuantileMergeOperation<ApproxQuantileScalarOperation>>(
+	    LogicalType::BLOB, LogicalType::DOUBLE);
+	fun.bind = BindApproxQuantile;
+	fun.serialize = ApproximateQuantileBindData::Serialize;
+	fun.deserialize = ApproximateQuantileBindData::Deserialize;
+	fun.arguments.emplace_back(LogicalType::FLOAT);
+	approx_quantile_merge.AddFunction(fun);
+
+	using LIST_OP = ApproxQuantileMergeOperation<ApproxQuantileListOperation<double>>;
+	auto list_fun = ApproxQuantileListAggregate<ApproxQuantileState, string_t, list_entry_t, LIST_OP>(
+	    LogicalType::BLOB, LogicalType::DOUBLE);
+	list_fun.bind = BindApproxQuantile;
+	list_fun.serialize = ApproximateQuantileBindData::Serialize;
+	list_fun.deserialize = ApproximateQuantileBindData::Deserialize;
+	list_fun.arguments.push_back(LogicalType::LIST(LogicalType::FLOAT));
+	approx_quantile_merge.AddFunction(list_fun);
+
+	return approx_quantile_merge;
+}
+
 AggregateFunctionSet ApproxQuantileFun::GetFunctions() {
 	AggregateFunctionSet approx_quantile;
 	approx_quantile.AddFunction(AggregateFunction({LogicalTypeId::DECIMAL, LogicalType::FLOAT}, LogicalTypeId::DECIMAL,
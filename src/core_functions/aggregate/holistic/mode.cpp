@@ -198,10 +198,28 @@ struct BaseModeFunction {
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
 		if (!source.frequency_map) {
 			return;
 		}
+		if (aggr_input_data.combine_type == AggregateCombineType::ALLOW_DESTRUCTIVE) {
+			// Steal the map of the source and merge the smaller map into the larger one
+			auto &other = const_cast<STATE &>(source); // NOLINT: destructive combine explicitly allows destruction
+			if (!target.frequency_map || target.frequency_map->size() < other.frequency_map->size()) {
+				std::swap(target.frequency_map, other.frequency_map);
+			}
+			if (other.frequency_map) {
+				for (auto &val : *other.frequency_map) {
+					auto &i = (*target.frequency_map)[val.first];
+					i.count += val.second.count;
+					i.first_row = MinValue(i.first_row, val.second.first_row);
+				}
+				delete other.frequency_map;
+				other.frequency_map = nullptr;
+			}
+			target.count += other.count;
+			return;
+		}
 		if (!target.frequency_map) {
 			// Copy - don't destroy! Otherwise windowing will break.
 			target.frequency_map = new typename STATE::Counts(*source.frequency_map);
@@ -70,8 +70,14 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION(AliasFun),
 	DUCKDB_SCALAR_FUNCTION_ALIAS(ApplyFun),
 	DUCKDB_AGGREGATE_FUNCTION(ApproxCountDistinctFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxCountDistinctMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxCountDistinctStateFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(ApproxQuantileFun),
+	DUCKDB_AGGREGATE_FUNCTION_SET(ApproxQuantileMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxQuantileStateFun),
 	DUCKDB_AGGREGATE_FUNCTION(ApproxTopKFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxTopKMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(ApproxTopKStateFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(ArgMaxFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(ArgMaxNullFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(ArgMinFun),
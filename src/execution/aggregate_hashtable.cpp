@@ -35,13 +35,17 @@ GroupedAggregateHashTable::AggregateHTAppendState::AggregateHTAppendState()
       addresses(LogicalType::POINTER) {
 }
 
+GroupedAggregateHashTable::DictionaryState::DictionaryState()
+    : dictionary_id(0), capacity(0), unique_entries(STANDARD_VECTOR_SIZE), unique_addresses(LogicalType::POINTER) {
+}
+
 GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, Allocator &allocator,
                                                      vector<LogicalType> group_types_p,
                                                      vector<LogicalType> payload_types_p,
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -71,6 +75,7 @@ void GroupedAggregateHashTable::InitializePartitionedData() {
 	D_ASSERT(GetLayout().GetDataWidth() == layout.GetDataWidth());
 	D_ASSERT(GetLayout().GetRowWidth() == layout.GetRowWidth());
 
+	ResetDictionaryState();
 	partitioned_data->InitializeAppendState(state.append_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
 }
 
@@ -140,6 +145,9 @@ idx_t GroupedAggregateHashTable::ApplyBitMask(hash_t hash) const {
 
 void GroupedAggregateHashTable::Verify() {
 #ifdef DEBUG
+	if (skip_lookups) {
+		return; // The pointer table is not used
+	}
 	idx_t total_count = 0;
 	for (idx_t i = 0; i < capacity; i++) {
 		const auto &entry = entries[i];
@@ -156,6 +164,11 @@ void GroupedAggregateHashTable::Verify() {
 
 void GroupedAggregateHashTable::ClearPointerTable() {
 	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
+	ResetDictionaryState();
+}
+
+void GroupedAggregateHashTable::ResetDictionaryState() {
+	dictionary_state.dictionary_id = 0;
 }
 
 void GroupedAggregateHashTable::ResetCount() {
@@ -166,6 +179,14 @@ void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
 
+void GroupedAggregateHashTable::SkipLookups() {
+	skip_lookups = true;
+}
+
+bool GroupedAggregateHashTable::SkipsLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::Resize(idx_t size) {
 	D_ASSERT(size >= STANDARD_VECTOR_SIZE);
 	D_ASSERT(IsPowerOfTwo(size));
@@ -227,6 +248,13 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 }
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	if (groups.ColumnCount() == 1 && groups.data[0].GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		const auto new_group_count = TryAddDictionaryGroups(groups, payload, filter);
+		if (new_group_count.IsValid()) {
+			return new_group_count.GetIndex();
+		}
+	}
+
 	Vector hashes(LogicalType::HASH);
 	groups.Hash(hashes);
 
@@ -250,6 +278,82 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
+	UpdateAggregates(payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+optional_idx GroupedAggregateHashTable::TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload,
+                                                               const unsafe_vector<idx_t> &filter) {
+	//! Dictionaries that are larger than this are not worth caching
+	static constexpr idx_t MAXIMUM_DICTIONARY_SIZE = 20000;
+
+	// only dictionaries that are shared between vectors (e.g., by a storage segment) are cached
+	auto &dict_vector = groups.data[0];
+	const auto dictionary_size = DictionaryVector::DictionarySize(dict_vector);
+	const auto dictionary_id = DictionaryVector::DictionaryId(dict_vector);
+	if (!dictionary_size.IsValid() || dictionary_id == 0 || dictionary_size.GetIndex() > MAXIMUM_DICTIONARY_SIZE) {
+		return optional_idx();
+	}
+	const auto dict_size = dictionary_size.GetIndex();
+
+	auto &dict_state = dictionary_state;
+	if (dict_state.dictionary_id != dictionary_id) {
+		// a new dictionary: none of its entries have been looked up yet
+		if (dict_size > dict_state.capacity) {
+			dict_state.dictionary_addresses = make_unsafe_uniq_array_uninitialized<data_ptr_t>(dict_size);
+			dict_state.found_entry = make_unsafe_uniq_array_uninitialized<bool>(dict_size);
+			dict_state.capacity = dict_size;
+		}
+		memset(dict_state.found_entry.get(), 0, dict_size * sizeof(bool));
+		dict_state.dictionary_id = dictionary_id;
+	}
+	D_ASSERT(dict_size <= dict_state.capacity);
+
+	// collect the dictionary entries that occur in this chunk, but have not been looked up yet
+	const auto &dict_sel = DictionaryVector::SelVector(dict_vector);
+	auto found_entry = dict_state.found_entry.get();
+	idx_t unique_count = 0;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		const auto dict_idx = dict_sel.get_index(i);
+		dict_state.unique_entries.set_index(unique_count, dict_idx);
+		unique_count += !found_entry[dict_idx];
+		found_entry[dict_idx] = true;
+	}
+
+	// look up the new dictionary entries in the HT
+	idx_t new_group_count = 0;
+	auto dictionary_addresses = dict_state.dictionary_addresses.get();
+	if (unique_count != 0) {
+		auto &unique_values = dict_state.unique_values;
+		if (unique_values.ColumnCount() == 0) {
+			unique_values.InitializeEmpty(groups.GetTypes());
+		}
+		unique_values.data[0].Slice(DictionaryVector::Child(dict_vector), dict_state.unique_entries, unique_count);
+		unique_values.SetCardinality(unique_count);
+		new_group_count = FindOrCreateGroups(unique_values, dict_state.unique_addresses, state.new_groups);
+
+		const auto unique_addresses = FlatVector::GetData<data_ptr_t>(dict_state.unique_addresses);
+		for (idx_t i = 0; i < unique_count; i++) {
+			dictionary_addresses[dict_state.unique_entries.get_index(i)] =
+			    unique_addresses[i] + layout.GetAggrOffset();
+		}
+	}
+
+	// the groups of all rows are known now, update the aggregates
+	state.addresses.SetVectorType(VectorType::FLAT_VECTOR);
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		addresses[i] = dictionary_addresses[dict_sel.get_index(i)];
+	}
+	UpdateAggregates(payload, filter);
+
+	Verify();
+	return new_group_count;
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	auto &aggregates = layout.GetAggregates();
 	idx_t filter_idx = 0;
 	idx_t payload_idx = 0;
@@ -276,9 +380,6 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 		VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(aggr.payload_size), payload.size());
 		filter_idx++;
 	}
-
-	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -314,11 +415,12 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
 	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
-	D_ASSERT(capacity - Count() >= groups.size()); // we need to be able to fit at least one vector of data
+	// we need to be able to fit at least one vector of data
+	D_ASSERT(skip_lookups || capacity - Count() >= groups.size());
 
 	group_hashes_v.Flatten(groups.size());
 	auto hashes = FlatVector::GetData<hash_t>(group_hashes_v);
@@ -326,20 +428,6 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	addresses_v.Flatten(groups.size());
 	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
 
-	// Compute the entry in the table based on the hash using a modulo,
-	// and precompute the hash salts for faster comparison below
-	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
-	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
-	for (idx_t r = 0; r < groups.size(); r++) {
-		const auto &hash = hashes[r];
-		ht_offsets[r] = ApplyBitMask(hash);
-		D_ASSERT(ht_offsets[r] == hash % capacity);
-		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
-	}
-
-	// we start out with all entries [0, 1, 2, ..., groups.size()]
-	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
-
 	// Make a chunk that references the groups and the hashes and convert to unified format
 	if (state.group_chunk.ColumnCount() == 0) {
 		state.group_chunk.InitializeEmpty(layout.GetTypes());
@@ -359,6 +447,36 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Every row becomes a new group, duplicate groups are combined when the partitions are finalized
+		const auto &all_rows = *FlatVector::IncrementalSelectionVector();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, all_rows, groups.size());
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, all_rows, groups.size());
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		count += groups.size();
+		return groups.size();
+	}
+
+	// Compute the entry in the table based on the hash using a modulo,
+	// and precompute the hash salts for faster comparison below
+	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
+	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
+	for (idx_t r = 0; r < groups.size(); r++) {
+		const auto &hash = hashes[r];
+		ht_offsets[r] = ApplyBitMask(hash);
+		D_ASSERT(ht_offsets[r] == hash % capacity);
+		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
+	}
+
+	// we start out with all entries [0, 1, 2, ..., groups.size()]
+	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -548,6 +666,7 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 }
 
 void GroupedAggregateHashTable::UnpinData() {
+	ResetDictionaryState();
 	partitioned_data->FlushAppendState(state.append_state);
 	partitioned_data->Unpin();
 }
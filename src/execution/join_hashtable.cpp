@@ -1,5 +1,7 @@
 #include "duckdb/execution/join_hashtable.hpp"
 
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -20,7 +22,8 @@ JoinHashTable::SharedState::SharedState()
 
 JoinHashTable::ProbeState::ProbeState()
     : SharedState(), salt_v(LogicalType::UBIGINT), ht_offsets_v(LogicalType::UBIGINT),
-      ht_offsets_dense_v(LogicalType::UBIGINT), non_empty_sel(STANDARD_VECTOR_SIZE) {
+      ht_offsets_dense_v(LogicalType::UBIGINT), ht_entries_dense_v(LogicalType::UBIGINT),
+      non_empty_sel(STANDARD_VECTOR_SIZE), salt_no_match_sel(STANDARD_VECTOR_SIZE) {
 }
 
 JoinHashTable::InsertState::InsertState(const JoinHashTable &ht)
@@ -34,7 +37,7 @@ JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition>
     : buffer_manager(BufferManager::GetBufferManager(context)), conditions(conditions_p),
       build_types(std::move(btypes)), output_columns(output_columns_p), entry_size(0), tuple_size(0),
       vfound(Value::BOOLEAN(false)), join_type(type_p), finalized(false), has_null(false),
-      radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      radix_bits(INITIAL_RADIX_BITS) {
 	for (idx_t i = 0; i < conditions.size(); ++i) {
 		auto &condition = conditions[i];
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -90,6 +93,8 @@ JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition>
 	}
 
 	chains_longer_than_one = false;
+	insert_duplicate_keys = needs_chain_matcher || (join_type != JoinType::SEMI && join_type != JoinType::ANTI &&
+	                                                join_type != JoinType::MARK);
 	row_matcher_build.Initialize(true, layout, equality_predicates);
 
 	const auto &offsets = layout.GetOffsets();
@@ -100,6 +105,7 @@ JoinHashTable::JoinHashTable(ClientContext &context, const vector<JoinCondition>
 	data_collection = make_uniq<TupleDataCollection>(buffer_manager, layout);
 	sink_collection =
 	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	InitializePartitionMasks();
 
 	dead_end = make_unsafe_uniq_array_uninitialized<data_t>(layout.GetRowWidth());
 	memset(dead_end.get(), 0, layout.GetRowWidth());
@@ -132,12 +138,12 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	sink_collection->Combine(*other.sink_collection);
 }
 
-static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const idx_t &bitmask) {
+static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, const JoinHashTable &ht) {
 	if (hashes_v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 		D_ASSERT(!ConstantVector::IsNull(hashes_v));
 		auto indices = ConstantVector::GetData<hash_t>(hashes_v);
 		hash_t salt = ht_entry_t::ExtractSaltWithNulls(*indices);
-		idx_t offset = *indices & bitmask;
+		idx_t offset = ht.GetPointerTableOffset(*indices);
 		*indices = offset | salt;
 		hashes_v.Flatten(count);
 	} else {
@@ -145,7 +151,7 @@ static void ApplyBitmaskAndGetSaltBuild(Vector &hashes_v, const idx_t &count, co
 		auto hashes = FlatVector::GetData<hash_t>(hashes_v);
 		for (idx_t i = 0; i < count; i++) {
 			idx_t salt = ht_entry_t::ExtractSaltWithNulls(hashes[i]);
-			idx_t offset = hashes[i] & bitmask;
+			idx_t offset = ht.GetPointerTableOffset(hashes[i]);
 			hashes[i] = offset | salt;
 		}
 	}
@@ -173,7 +179,7 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	for (idx_t i = 0; i < count; i++) {
 		const auto row_index = sel.get_index(i);
 		auto uvf_index = hashes_v_unified.sel->get_index(row_index);
-		auto ht_offset = hashes[uvf_index] & ht->bitmask;
+		auto ht_offset = ht->GetPointerTableOffset(hashes[uvf_index]);
 		ht_offsets_dense[i] = ht_offset;
 		ht_offsets[row_index] = ht_offset;
 	}
@@ -203,6 +209,7 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 	}
 
 	auto pointers_result = FlatVector::GetData<data_ptr_t>(pointers_result_v);
+	auto entries_dense = reinterpret_cast<ht_entry_t *>(FlatVector::GetData<hash_t>(state.ht_entries_dense_v));
 	auto row_ptr_insert_to = FlatVector::GetData<data_ptr_t>(state.rhs_row_locations);
 
 	const SelectionVector *remaining_sel = &state.non_empty_sel;
@@ -213,44 +220,37 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 
 	while (remaining_count > 0) {
 		idx_t salt_match_count = 0;
+		idx_t salt_no_match_count = 0;
 		idx_t key_no_match_count = 0;
 
-		// for each entry, linear probing until
+		// gather the entries of all remaining rows in a dense loop, so that the cache misses on the big entries array
+		// are not interleaved with the comparisons below
+		for (idx_t i = 0; i < remaining_count; i++) {
+			const auto row_index = remaining_sel->get_index(i);
+			entries_dense[i] = entries[ht_offsets[row_index]];
+		}
+
+		// for each entry, one step of linear probing:
 		// a) an empty entry is found -> return nullptr (do nothing, as vector is zeroed)
 		// b) an entry is found where the salt matches -> need to compare the keys
+		// c) an entry is found where the salt does not match -> move to the next entry in the next iteration
+		// this loop is branch-free, so the compiler can vectorize the salt comparisons
 		for (idx_t i = 0; i < remaining_count; i++) {
 			const auto row_index = remaining_sel->get_index(i);
-
-			idx_t &ht_offset = ht_offsets[row_index];
-			bool occupied;
-			ht_entry_t entry;
+			const auto &entry = entries_dense[i];
+			const bool occupied = entry.IsOccupied();
 
 			if (USE_SALTS) {
-				hash_t row_salt = salts[row_index];
-				// increment the ht_offset of the entry as long as next entry is occupied and salt does not match
-				while (true) {
-					entry = entries[ht_offset];
-					occupied = entry.IsOccupied();
-					bool salt_match = entry.GetSalt() == row_salt;
-
-					// condition for incrementing the ht_offset: occupied and row_salt does not match -> move to next
-					// entry
-					if (!occupied || salt_match) {
-						break;
-					}
-
-					IncrementAndWrap(ht_offset, ht->bitmask);
-				}
+				const bool salt_match = entry.GetSalt() == salts[row_index];
+				state.salt_match_sel.set_index(salt_match_count, row_index);
+				salt_match_count += occupied & salt_match;
+				state.salt_no_match_sel.set_index(salt_no_match_count, row_index);
+				salt_no_match_count += occupied & !salt_match;
 			} else {
-				entry = entries[ht_offset];
-				occupied = entry.IsOccupied();
+				state.salt_match_sel.set_index(salt_match_count, row_index);
+				salt_match_count += occupied;
 			}
 
-			// the entries we need to process in the next iteration are the ones that are occupied and the row_salt
-			// does not match, the ones that are empty need no further processing
-			state.salt_match_sel.set_index(salt_match_count, row_index);
-			salt_match_count += occupied;
-
 			// entry might be empty, so the pointer in the entry is nullptr, but this does not matter as the row
 			// will not be compared anyway as with an empty entry we are already done
 			row_ptr_insert_to[row_index] = entry.GetPointerOrNull();
@@ -278,12 +278,20 @@ static inline void GetRowPointersInternal(DataChunk &keys, TupleDataChunkState &
 				const auto row_index = state.key_no_match_sel.get_index(i);
 				auto &ht_offset = ht_offsets[row_index];
 
-				IncrementAndWrap(ht_offset, ht->bitmask);
+				IncrementAndWrapKeepUpperBits(ht_offset, ht->bitmask);
 			}
 		}
 
+		// Linear probing: the entries where the salt does not match move to the next entry in the HT, and are
+		// processed together with the entries where the keys did not match
+		for (idx_t i = 0; i < salt_no_match_count; i++) {
+			const auto row_index = state.salt_no_match_sel.get_index(i);
+			IncrementAndWrapKeepUpperBits(ht_offsets[row_index], ht->bitmask);
+			state.key_no_match_sel.set_index(key_no_match_count + i, row_index);
+		}
+
 		remaining_sel = &state.key_no_match_sel;
-		remaining_count = key_no_match_count;
+		remaining_count = key_no_match_count + salt_no_match_count;
 	}
 }
 
@@ -521,12 +529,14 @@ static inline void InsertMatchesAndIncrementMisses(atomic<ht_entry_t> entries[],
                                                    JoinHashTable &ht, const data_ptr_t lhs_row_locations[],
                                                    idx_t ht_offsets_and_salts[], const idx_t capacity_mask,
                                                    const idx_t key_match_count, const idx_t key_no_match_count) {
-	if (key_match_count != 0) {
+	// if we do not insert duplicate keys, the rows that match do not need to be inserted: their keys are in the HT
+	const auto insert_count = ht.insert_duplicate_keys ? key_match_count : 0;
+	if (insert_count != 0) {
 		ht.chains_longer_than_one = true;
 	}
 
 	// Insert the rows that match
-	for (idx_t i = 0; i < key_match_count; i++) {
+	for (idx_t i = 0; i < insert_count; i++) {
 		const auto need_compare_idx = state.key_match_sel.get_index(i);
 		const auto entry_index = state.salt_match_sel.get_index(need_compare_idx);
 
@@ -544,7 +554,7 @@ static inline void InsertMatchesAndIncrementMisses(atomic<ht_entry_t> entries[],
 		const auto entry_index = state.salt_match_sel.get_index(need_compare_idx);
 
 		idx_t &ht_offset_and_salt = ht_offsets_and_salts[entry_index];
-		IncrementAndWrap(ht_offset_and_salt, capacity_mask);
+		IncrementAndWrapKeepUpperBits(ht_offset_and_salt, capacity_mask);
 
 		state.remaining_sel.set_index(i, entry_index);
 	}
@@ -555,7 +565,7 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
                              JoinHashTable::InsertState &state, const TupleDataCollection &data_collection,
                              JoinHashTable &ht) {
 	D_ASSERT(hashes_v.GetType().id() == LogicalType::HASH);
-	ApplyBitmaskAndGetSaltBuild(hashes_v, count, ht.bitmask);
+	ApplyBitmaskAndGetSaltBuild(hashes_v, count, ht);
 
 	// the offset for each row to insert
 	const auto ht_offsets_and_salts = FlatVector::GetData<idx_t>(hashes_v);
@@ -593,8 +603,8 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
 		}
 	}
 
-	// use the ht bitmask to make the modulo operation faster but keep the salt bits intact
-	idx_t capacity_mask = ht.bitmask | ht_entry_t::SALT_MASK;
+	// use the ht bitmask to make the modulo operation faster but keep the salt (and partition) bits intact
+	idx_t capacity_mask = ht.bitmask;
 	while (remaining_count > 0) {
 		idx_t salt_match_count = 0;
 
@@ -622,7 +632,7 @@ static void InsertHashesLoop(atomic<ht_entry_t> entries[], Vector &row_locations
 					break;
 				}
 
-				IncrementAndWrap(ht_offset_and_salt, capacity_mask);
+				IncrementAndWrapKeepUpperBits(ht_offset_and_salt, capacity_mask);
 			}
 
 			if (!occupied) { // insert into free
@@ -679,10 +689,26 @@ void JoinHashTable::InsertHashes(Vector &hashes_v, const idx_t count, TupleDataC
 	}
 }
 
-void JoinHashTable::InitializePointerTable() {
+void JoinHashTable::InitializePointerTable(bool partitioned) {
 	capacity = PointerTableCapacity(Count());
 	D_ASSERT(IsPowerOfTwo(capacity));
 
+	// every partition gets a pointer table that fits the largest partition, which only pays off if the partitions
+	// are not too skewed
+	const auto partition_capacity = PointerTableCapacity(max_partition_count);
+	partitioned = partitioned && !partition_chunk_offsets.empty() && radix_bits != 0 &&
+	              (partition_capacity << radix_bits) <= 2 * capacity;
+	if (partitioned) {
+		capacity = partition_capacity << radix_bits;
+		const auto partition_capacity_bits = NumericCast<idx_t>(CountZeros<uint64_t>::Trailing(partition_capacity));
+		D_ASSERT(partition_capacity_bits <= RadixPartitioning::Shift(radix_bits));
+		partition_mask = RadixPartitioning::Mask(radix_bits);
+		partition_shift = RadixPartitioning::Shift(radix_bits) - partition_capacity_bits;
+	} else {
+		partition_mask = 0;
+		partition_shift = 0;
+	}
+
 	if (hash_map.get()) {
 		// There is already a hash map
 		auto current_capacity = hash_map.GetSize() / sizeof(ht_entry_t);
@@ -690,7 +716,7 @@ void JoinHashTable::InitializePointerTable() {
 			// Need more space
 			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 			entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
-		} else {
+		} else if (!partitioned) {
 			// Just use the current hash map
 			capacity = current_capacity;
 		}
@@ -699,12 +725,12 @@ void JoinHashTable::InitializePointerTable() {
 		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 		entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
 	}
-	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
+	D_ASSERT(hash_map.GetSize() >= capacity * sizeof(ht_entry_t));
 
 	// initialize HT with all-zero entries
 	std::fill_n(entries, capacity, ht_entry_t::GetEmptyEntry());
 
-	bitmask = capacity - 1;
+	bitmask = partitioned ? partition_capacity - 1 : capacity - 1;
 }
 
 void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel) {
@@ -1379,7 +1405,10 @@ idx_t JoinHashTable::GetRemainingSize() const {
 
 	idx_t count = 0;
 	idx_t data_size = 0;
-	for (idx_t partition_idx = partition_end; partition_idx < num_partitions; partition_idx++) {
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		if (completed_partitions.RowIsValidUnsafe(partition_idx)) {
+			continue;
+		}
 		count += partitions[partition_idx]->Count();
 		data_size += partitions[partition_idx]->SizeInBytes();
 	}
@@ -1388,6 +1417,16 @@ idx_t JoinHashTable::GetRemainingSize() const {
 }
 
 void JoinHashTable::Unpartition() {
+	// the partitions are combined in order, so we can keep track of the chunks that belong to each partition
+	auto &partitions = sink_collection->GetPartitions();
+	partition_chunk_offsets.resize(partitions.size() + 1);
+	partition_chunk_offsets[0] = 0;
+	max_partition_count = 0;
+	for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+		auto &partition = *partitions[partition_idx];
+		partition_chunk_offsets[partition_idx + 1] = partition_chunk_offsets[partition_idx] + partition.ChunkCount();
+		max_partition_count = MaxValue(max_partition_count, partition.Count());
+	}
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
@@ -1413,6 +1452,23 @@ void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t
 	radix_bits += added_bits;
 	sink_collection =
 	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	InitializePartitionMasks();
+}
+
+void JoinHashTable::InitializePartitionMasks() {
+	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
+	current_partitions.Initialize(num_partitions);
+	current_partitions.SetAllInvalid(num_partitions);
+	completed_partitions.Initialize(num_partitions);
+	completed_partitions.SetAllInvalid(num_partitions);
+}
+
+idx_t JoinHashTable::GetCurrentPartitionCount() const {
+	return current_partitions.CountValid(RadixPartitioning::NumberOfPartitions(radix_bits));
+}
+
+idx_t JoinHashTable::GetCompletedPartitionCount() const {
+	return completed_partitions.CountValid(RadixPartitioning::NumberOfPartitions(radix_bits));
 }
 
 void JoinHashTable::Repartition(JoinHashTable &global_ht) {
@@ -1425,6 +1481,7 @@ void JoinHashTable::Repartition(JoinHashTable &global_ht) {
 
 void JoinHashTable::Reset() {
 	data_collection->Reset();
+	partition_chunk_offsets.clear();
 	hash_map.Reset();
 	finalized = false;
 }
@@ -1435,19 +1492,31 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 	}
 
 	const auto num_partitions = RadixPartitioning::NumberOfPartitions(radix_bits);
-	if (partition_end == num_partitions) {
+	current_partitions.SetAllInvalid(num_partitions);
+	if (completed_partitions.CheckAllValid(num_partitions)) {
 		return false;
 	}
 
-	// Start where we left off
+	// Gather the partitions that have not been built yet
 	auto &partitions = sink_collection->GetPartitions();
-	partition_start = partition_end;
+	vector<idx_t> partition_indices;
+	partition_indices.reserve(num_partitions);
+	for (idx_t partition_idx = 0; partition_idx < num_partitions; partition_idx++) {
+		if (!completed_partitions.RowIsValidUnsafe(partition_idx)) {
+			partition_indices.push_back(partition_idx);
+		}
+	}
 
-	// Determine how many partitions we can do next (at least one)
+	// Build the smallest partitions first, so that as many partitions as possible fit in this round. Probe-side rows
+	// that belong to the partitions of the first round never have to be spilled
+	std::stable_sort(partition_indices.begin(), partition_indices.end(), [&](const idx_t &lhs, const idx_t &rhs) {
+		return partitions[lhs]->SizeInBytes() < partitions[rhs]->SizeInBytes();
+	});
+
+	// Determine which partitions we can do next (at least one)
 	idx_t count = 0;
 	idx_t data_size = 0;
-	idx_t partition_idx;
-	for (partition_idx = partition_start; partition_idx < num_partitions; partition_idx++) {
+	for (auto &partition_idx : partition_indices) {
 		auto incl_count = count + partitions[partition_idx]->Count();
 		auto incl_data_size = data_size + partitions[partition_idx]->SizeInBytes();
 		auto incl_ht_size = incl_data_size + PointerTableSize(incl_count);
@@ -1456,12 +1525,11 @@ bool JoinHashTable::PrepareExternalFinalize(const idx_t max_ht_size) {
 		}
 		count = incl_count;
 		data_size = incl_data_size;
-	}
-	partition_end = partition_idx;
 
-	// Move the partitions to the main data collection
-	for (partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
+		// Move the partition to the main data collection
 		data_collection->Combine(*partitions[partition_idx]);
+		current_partitions.SetValidUnsafe(partition_idx);
+		completed_partitions.SetValidUnsafe(partition_idx);
 	}
 	D_ASSERT(Count() == count);
 
@@ -1495,7 +1563,7 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &keys
 	true_sel.Initialize();
 	false_sel.Initialize();
 	auto true_count = RadixPartitioning::Select(hashes, FlatVector::IncrementalSelectionVector(), keys.size(),
-	                                            radix_bits, partition_end, &true_sel, &false_sel);
+	                                            radix_bits, current_partitions, &true_sel, &false_sel);
 	auto false_count = keys.size() - true_count;
 
 	CreateSpillChunk(spill_chunk, keys, payload, hashes);
@@ -1560,22 +1628,24 @@ void ProbeSpill::Finalize() {
 }
 
 void ProbeSpill::PrepareNextProbe() {
+	global_spill_collection = nullptr;
 	auto &partitions = global_partitions->GetPartitions();
-	if (partitions.empty() || ht.partition_start == partitions.size()) {
+	for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+		if (!ht.current_partitions.RowIsValidUnsafe(partition_idx)) {
+			continue;
+		}
+		// Move the partitions of the current round to the global spill collection
+		auto &partition = partitions[partition_idx];
+		if (!global_spill_collection || global_spill_collection->Count() == 0) {
+			global_spill_collection = std::move(partition);
+		} else {
+			global_spill_collection->Combine(*partition);
+		}
+	}
+	if (!global_spill_collection) {
 		// Can't probe, just make an empty one
 		global_spill_collection =
 		    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), probe_types);
-	} else {
-		// Move specific partitions to the global spill collection
-		global_spill_collection = std::move(partitions[ht.partition_start]);
-		for (idx_t i = ht.partition_start + 1; i < ht.partition_end; i++) {
-			auto &partition = partitions[i];
-			if (global_spill_collection->Count() == 0) {
-				global_spill_collection = std::move(partition);
-			} else {
-				global_spill_collection->Combine(*partition);
-			}
-		}
 	}
 	consumer = make_uniq<ColumnDataConsumer>(*global_spill_collection, column_ids);
 	consumer->InitializeScan();
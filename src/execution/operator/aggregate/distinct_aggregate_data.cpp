@@ -157,6 +157,7 @@ idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
 		}
 		//! Create a new table and assign its index to the aggregate
 		table_map[agg_idx] = table_inputs.size();
+		table_indices.push_back(agg_idx);
 		table_inputs.push_back(std::ref(aggregate));
 	}
 	//! Every distinct aggregate needs to be assigned an index
@@ -175,6 +176,21 @@ const unsafe_vector<idx_t> &DistinctAggregateCollectionInfo::Indices() const {
 	return this->indices;
 }
 
+bool DistinctAggregateCollectionInfo::OwnsTable(idx_t aggr_idx) const {
+	D_ASSERT(table_map.count(aggr_idx));
+	return table_indices[table_map.at(aggr_idx)] == aggr_idx;
+}
+
+unsafe_vector<idx_t> DistinctAggregateCollectionInfo::TableAggregates(idx_t table_idx) const {
+	unsafe_vector<idx_t> result;
+	for (auto &idx : indices) {
+		if (table_map.at(idx) == table_idx) {
+			result.push_back(idx);
+		}
+	}
+	return result;
+}
+
 static vector<idx_t> GetDistinctIndices(vector<unique_ptr<Expression>> &aggregates) {
 	vector<idx_t> distinct_indices;
 	for (idx_t i = 0; i < aggregates.size(); i++) {
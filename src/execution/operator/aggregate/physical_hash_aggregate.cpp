@@ -7,6 +7,7 @@
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/operator/aggregate/distinct_aggregate_data.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/interrupt.hpp"
 #include "duckdb/parallel/pipeline.hpp"
@@ -278,7 +279,8 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 
 		D_ASSERT(distinct_info.table_map.count(idx));
 		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
+		if (!distinct_data->radix_tables[table_idx] || !distinct_info.OwnsTable(idx)) {
+			// The table is shared with a previous aggregate with identical input, which already sinks into it
 			continue;
 		}
 		D_ASSERT(distinct_data->radix_tables[table_idx]);
@@ -559,8 +561,6 @@ private:
 	unique_ptr<LocalSourceState> radix_table_lstate;
 	bool blocked = false;
 	idx_t aggregation_idx = 0;
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
 };
 
 void HashAggregateDistinctFinalizeEvent::Schedule() {
@@ -589,7 +589,8 @@ idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
 			auto &aggregate = aggregates[agg_idx];
 			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
 
-			if (!aggr.IsDistinct()) {
+			if (!aggr.IsDistinct() || !distinct_data.info.OwnsTable(agg_idx)) {
+				// Tables that are shared by multiple aggregates are only scanned once
 				aggregate_sources.push_back(nullptr);
 				continue;
 			}
@@ -620,8 +621,6 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::ExecuteTask(TaskExecution
 		}
 		D_ASSERT(res == TaskExecutionResult::TASK_FINISHED);
 		aggregation_idx = 0;
-		payload_idx = 0;
-		next_payload_idx = 0;
 		local_sink_state = nullptr;
 	}
 	event->FinishTask();
@@ -667,24 +666,26 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 
 	const auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
 
+	// The offsets of the aggregates in the payload
+	vector<idx_t> payload_offsets;
+	idx_t payload_offset = 0;
+	for (auto &aggregate : aggregates) {
+		payload_offsets.push_back(payload_offset);
+		payload_offset += aggregate->Cast<BoundAggregateExpression>().children.size();
+	}
+
 	auto &agg_idx = aggregation_idx;
 	for (; agg_idx < op.grouped_aggregate_data.aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		if (!blocked) {
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
-		}
-
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
+		// If aggregate is not distinct, or its table is scanned for another aggregate, skip it
+		if (!distinct_data.IsDistinct(agg_idx) || !info.OwnsTable(agg_idx)) {
 			continue;
 		}
 
 		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
 		const auto &table_idx = distinct_data.info.table_map.at(agg_idx);
 		auto &radix_table = distinct_data.radix_tables[table_idx];
+		// All aggregates with identical input are updated with a single scan of their table
+		const auto table_aggregates = info.TableAggregates(table_idx);
 
 		auto &sink = *distinct_state.radix_states[table_idx];
 		if (!blocked) {
@@ -721,14 +722,19 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 			}
 			group_chunk.SetCardinality(output_chunk);
 
-			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
-				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
+			for (auto &table_agg_idx : table_aggregates) {
+				const auto payload_idx = payload_offsets[table_agg_idx];
+				for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size;
+				     child_idx++) {
+					aggregate_input_chunk.data[payload_idx + child_idx].Reference(
+					    output_chunk.data[group_by_size + child_idx]);
+				}
 			}
 			aggregate_input_chunk.SetCardinality(output_chunk);
 
 			// Sink it into the main ht
-			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
+			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk,
+			                              table_aggregates);
 		}
 		blocked = false;
 	}
@@ -771,10 +777,26 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeInternal(Pipeline &pipeline, Eve
 		return FinalizeDistinct(pipeline, event, context, gstate_p);
 	}
 
+	idx_t sink_count = 0;
+	idx_t skipped_count = 0;
+	idx_t skipped_threads = 0;
 	for (idx_t i = 0; i < groupings.size(); i++) {
 		auto &grouping = groupings[i];
 		auto &grouping_gstate = gstate.grouping_states[i];
 		grouping.table_data.Finalize(context, *grouping_gstate.table_state);
+
+		idx_t grouping_sink_count, grouping_skipped_count, grouping_skipped_threads;
+		grouping.table_data.GetSkippedLookups(*grouping_gstate.table_state, grouping_sink_count,
+		                                      grouping_skipped_count, grouping_skipped_threads);
+		sink_count += grouping_sink_count;
+		skipped_count += grouping_skipped_count;
+		skipped_threads = MaxValue(skipped_threads, grouping_skipped_threads);
+	}
+	if (skipped_count != 0) {
+		// report that (some of the) threads stopped pre-aggregating because it did not reduce the data
+		QueryProfiler::Get(context).AddExtraInfo(
+		    *this, "Pre-Aggregation Skipped",
+		    StringUtil::Format("%llu of %llu rows (%llu threads)", skipped_count, sink_count, skipped_threads));
 	}
 	return SinkFinalizeType::READY;
 }
@@ -919,6 +941,11 @@ InsertionOrderPreservingMap<string> PhysicalHashAggregate::ParamsToString() cons
 		}
 	}
 	result["Aggregates"] = aggregate_info;
+	if (grouped_aggregate_data.top_n) {
+		auto &top_n = *grouped_aggregate_data.top_n;
+		result["Top-N"] = StringUtil::Format("%s %s LIMIT %llu", aggregates[top_n.aggregate_idx]->GetName(),
+		                                     top_n.type == OrderType::DESCENDING ? "DESC" : "ASC", top_n.limit);
+	}
 	SetEstimatedCardinality(result, estimated_cardinality);
 	return result;
 }
@@ -0,0 +1,401 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	for (auto &expr : groups) {
+		group_types.push_back(expr->return_type);
+	}
+
+	vector<BoundAggregateExpression *> bindings;
+	vector<LogicalType> payload_types_filters;
+	for (auto &expr : aggregates) {
+		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_AGGREGATE);
+		D_ASSERT(expr->IsAggregate());
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		bindings.push_back(&aggr);
+
+		D_ASSERT(!aggr.IsDistinct());
+		for (auto &child : aggr.children) {
+			payload_types.push_back(child->return_type);
+		}
+		if (aggr.filter) {
+			payload_types_filters.push_back(aggr.filter->return_type);
+		}
+	}
+	for (const auto &pay_filters : payload_types_filters) {
+		payload_types.push_back(pay_filters);
+	}
+	aggregate_objects = AggregateObject::CreateAggregateObjects(bindings);
+
+	// the filters are evaluated on the payload chunk, so we move them behind the aggregate inputs
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		aggregate_input_idx += aggr.children.size();
+	}
+	for (auto &aggregate : aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto &bound_ref_expr = aggr.filter->Cast<BoundReferenceExpression>();
+			auto it = filter_indexes.find(aggr.filter.get());
+			if (it == filter_indexes.end()) {
+				filter_indexes[aggr.filter.get()] = bound_ref_expr.index;
+				bound_ref_expr.index = aggregate_input_idx++;
+			} else {
+				++aggregate_input_idx;
+			}
+		}
+	}
+}
+
+bool PhysicalStreamingAggregate::CanStreamAggregates(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expression : aggregates) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			// distinct aggregates would need a distinct table per group
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	//! The slots of the open group and of the group that is opened by the current chunk
+	static constexpr const idx_t OPEN_SLOTS = 2;
+
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op);
+	~StreamingAggregateState() override;
+
+	//! Aggregates a chunk and emits the groups that were closed by it
+	void Sink(DataChunk &input, DataChunk &chunk);
+	//! Emits the open group
+	void Flush(DataChunk &chunk);
+
+	data_ptr_t GetSlot(idx_t slot_idx) {
+		return slots.get() + slot_idx * layout.GetRowWidth();
+	}
+
+private:
+	//! Splits the chunk into runs of equal groups, returns whether the first run continues the open group
+	bool FindSegments(idx_t count);
+	//! Updates the states of the rows in [begin, end)
+	void UpdateRange(idx_t begin, idx_t end, ArenaAllocator &arena);
+	//! Finalizes the states into the aggregate columns of the chunk and destroys them
+	void FinalizeStates(Vector &states, DataChunk &chunk);
+
+public:
+	const PhysicalStreamingAggregate &op;
+	TupleDataLayout layout;
+	AggregateFilterDataSet filter_set;
+
+	DataChunk group_chunk;
+	DataChunk payload_chunk;
+	DataChunk range_payload;
+
+	//! The keys of the open group
+	DataChunk open_keys;
+	bool has_open;
+	//! The aggregate states: the two open slots, followed by one slot per group that is closed in the same chunk
+	unsafe_unique_array<data_t> slots;
+	idx_t open_slot;
+	idx_t next_slot;
+	//! The allocators of the open slots, and of the groups that are closed in the same chunk
+	unique_ptr<ArenaAllocator> open_arenas[OPEN_SLOTS];
+	ArenaAllocator chunk_arena;
+
+	//! The first row of every run of equal groups in the current chunk
+	SelectionVector starts;
+	idx_t segment_count;
+	//! The state slot of every row in the current chunk
+	data_ptr_t row_slots[STANDARD_VECTOR_SIZE];
+	bool boundaries[STANDARD_VECTOR_SIZE];
+	SelectionVector prev_sel;
+	SelectionVector curr_sel;
+	SelectionVector distinct_sel;
+	SelectionVector range_sel;
+	Vector addresses;
+	Vector states;
+};
+
+StreamingAggregateState::StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op)
+    : op(op), has_open(false), open_slot(0), next_slot(1), chunk_arena(Allocator::Get(context.client)),
+      segment_count(0), prev_sel(STANDARD_VECTOR_SIZE), curr_sel(STANDARD_VECTOR_SIZE),
+      distinct_sel(STANDARD_VECTOR_SIZE), range_sel(STANDARD_VECTOR_SIZE), addresses(LogicalType::POINTER),
+      states(LogicalType::POINTER) {
+	auto &allocator = Allocator::Get(context.client);
+	layout.Initialize(op.aggregate_objects);
+	filter_set.Initialize(context.client, op.aggregate_objects, op.payload_types);
+
+	group_chunk.InitializeEmpty(op.group_types);
+	payload_chunk.InitializeEmpty(op.payload_types);
+	range_payload.InitializeEmpty(op.payload_types);
+	open_keys.Initialize(allocator, op.group_types, 1);
+
+	slots = make_unsafe_uniq_array_uninitialized<data_t>((OPEN_SLOTS + STANDARD_VECTOR_SIZE) * layout.GetRowWidth());
+	for (auto &arena : open_arenas) {
+		arena = make_uniq<ArenaAllocator>(allocator);
+	}
+
+	starts.Initialize(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		prev_sel.set_index(i, i);
+		curr_sel.set_index(i, i + 1);
+	}
+}
+
+StreamingAggregateState::~StreamingAggregateState() {
+	if (!has_open) {
+		return;
+	}
+	FlatVector::GetData<data_ptr_t>(states)[0] = GetSlot(open_slot);
+	RowOperationsState row_state(*open_arenas[open_slot]);
+	RowOperations::DestroyStates(row_state, layout, states, 1);
+}
+
+bool StreamingAggregateState::FindSegments(idx_t count) {
+	memset(boundaries, 0, count * sizeof(bool));
+
+	// compare every row with its predecessor
+	bool continues = has_open;
+	for (idx_t col_idx = 0; col_idx < group_chunk.ColumnCount(); col_idx++) {
+		auto &keys = group_chunk.data[col_idx];
+		if (continues && VectorOperations::DistinctFrom(keys, open_keys.data[col_idx], nullptr, 1, &distinct_sel, nullptr)) {
+			continues = false;
+		}
+		if (count > 1) {
+			Vector prev(keys, prev_sel, count - 1);
+			Vector curr(keys, curr_sel, count - 1);
+			const auto distinct_count =
+			    VectorOperations::DistinctFrom(curr, prev, nullptr, count - 1, &distinct_sel, nullptr);
+			for (idx_t i = 0; i < distinct_count; i++) {
+				boundaries[distinct_sel.get_index(i) + 1] = true;
+			}
+		}
+	}
+
+	segment_count = 0;
+	starts.set_index(segment_count++, 0);
+	for (idx_t i = 1; i < count; i++) {
+		if (boundaries[i]) {
+			starts.set_index(segment_count++, i);
+		}
+	}
+	return continues;
+}
+
+void StreamingAggregateState::UpdateRange(idx_t begin, idx_t end, ArenaAllocator &arena) {
+	if (begin == end) {
+		return;
+	}
+	const auto count = end - begin;
+	for (idx_t i = 0; i < count; i++) {
+		range_sel.set_index(i, begin + i);
+	}
+	range_payload.Slice(payload_chunk, range_sel, count);
+	range_payload.SetCardinality(count);
+
+	auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+	memcpy(address_data, row_slots + begin, count * sizeof(data_ptr_t));
+	VectorOperations::AddInPlace(addresses, UnsafeNumericCast<int64_t>(layout.GetAggrOffset()), count);
+
+	idx_t payload_idx = 0;
+	auto &aggregates = layout.GetAggregates();
+	RowOperationsState row_state(arena);
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggregate = aggregates[aggr_idx];
+		if (aggregate.filter) {
+			RowOperations::UpdateFilteredStates(row_state, filter_set.GetFilterData(aggr_idx), aggregate, addresses,
+			                                    range_payload, payload_idx);
+		} else {
+			RowOperations::UpdateStates(row_state, aggregate, addresses, range_payload, payload_idx, count);
+		}
+		// move to the next aggregate
+		payload_idx += aggregate.child_count;
+		VectorOperations::AddInPlace(addresses, UnsafeNumericCast<int64_t>(aggregate.payload_size), count);
+	}
+}
+
+void StreamingAggregateState::FinalizeStates(Vector &states, DataChunk &chunk) {
+	RowOperationsState row_state(chunk_arena);
+	RowOperations::FinalizeStates(row_state, layout, states, chunk, op.groups.size());
+	RowOperations::DestroyStates(row_state, layout, states, chunk.size());
+}
+
+void StreamingAggregateState::Sink(DataChunk &input, DataChunk &chunk) {
+	// the output of the previous chunk has been consumed: release the memory of the groups it closed
+	chunk_arena.Reset();
+	open_arenas[next_slot]->Reset();
+
+	const auto count = input.size();
+	if (count == 0) {
+		return;
+	}
+
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		auto &group = op.groups[group_idx];
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+		auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+		group_chunk.data[group_idx].Reference(input.data[bound_ref_expr.index]);
+	}
+	idx_t aggregate_input_idx = 0;
+	for (auto &aggregate : op.aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		for (auto &child_expr : aggr.children) {
+			D_ASSERT(child_expr->type == ExpressionType::BOUND_REF);
+			auto &bound_ref_expr = child_expr->Cast<BoundReferenceExpression>();
+			payload_chunk.data[aggregate_input_idx++].Reference(input.data[bound_ref_expr.index]);
+		}
+	}
+	for (auto &aggregate : op.aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		if (aggr.filter) {
+			auto it = op.filter_indexes.find(aggr.filter.get());
+			D_ASSERT(it != op.filter_indexes.end());
+			payload_chunk.data[aggregate_input_idx++].Reference(input.data[it->second]);
+		}
+	}
+	group_chunk.SetCardinality(count);
+	payload_chunk.SetCardinality(count);
+
+	// assign a state to every run: the first run can continue the open group, the last run opens the next group
+	const auto continues = FindSegments(count);
+	const auto last = segment_count - 1;
+	const auto opens = !continues || segment_count > 1;
+	auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+	idx_t init_count = 0;
+	for (idx_t s = 0; s < segment_count; s++) {
+		data_ptr_t slot;
+		if (s == 0 && continues) {
+			slot = GetSlot(open_slot);
+		} else {
+			slot = s == last ? GetSlot(next_slot) : GetSlot(OPEN_SLOTS + s);
+			address_data[init_count++] = slot;
+		}
+		const auto end = s == last ? count : starts.get_index(s + 1);
+		for (auto row_idx = starts.get_index(s); row_idx < end; row_idx++) {
+			row_slots[row_idx] = slot;
+		}
+	}
+	RowOperations::InitializeStates(layout, addresses, *FlatVector::IncrementalSelectionVector(), init_count);
+
+	// the states of the open groups outlive the chunk, so they use their own allocators
+	const auto open_end = continues ? (segment_count > 1 ? starts.get_index(1) : count) : 0;
+	const auto next_begin = opens ? starts.get_index(last) : count;
+	UpdateRange(0, open_end, *open_arenas[open_slot]);
+	UpdateRange(open_end, next_begin, chunk_arena);
+	UpdateRange(next_begin, count, *open_arenas[next_slot]);
+
+	// emit the groups that were closed: the open group, and all runs but the last one
+	auto state_data = FlatVector::GetData<data_ptr_t>(states);
+	idx_t closed = 0;
+	if (has_open && !continues) {
+		for (idx_t col_idx = 0; col_idx < op.groups.size(); col_idx++) {
+			VectorOperations::Copy(open_keys.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+		}
+		state_data[closed++] = GetSlot(open_slot);
+	}
+	if (opens && last > 0) {
+		for (idx_t col_idx = 0; col_idx < op.groups.size(); col_idx++) {
+			VectorOperations::Copy(group_chunk.data[col_idx], chunk.data[col_idx], starts, last, 0, closed);
+		}
+		for (idx_t s = 0; s < last; s++) {
+			state_data[closed++] = row_slots[starts.get_index(s)];
+		}
+	}
+	if (closed) {
+		chunk.SetCardinality(closed);
+		FinalizeStates(states, chunk);
+	}
+
+	// the last run is the new open group
+	if (opens) {
+		std::swap(open_slot, next_slot);
+		has_open = true;
+		open_keys.Reset();
+		const auto key_idx = starts.get_index(last);
+		for (idx_t col_idx = 0; col_idx < op.groups.size(); col_idx++) {
+			VectorOperations::Copy(group_chunk.data[col_idx], open_keys.data[col_idx], key_idx + 1, key_idx, 0);
+		}
+		open_keys.SetCardinality(1);
+	}
+}
+
+void StreamingAggregateState::Flush(DataChunk &chunk) {
+	if (!has_open) {
+		return;
+	}
+	for (idx_t col_idx = 0; col_idx < op.groups.size(); col_idx++) {
+		VectorOperations::Copy(open_keys.data[col_idx], chunk.data[col_idx], 1, 0, 0);
+	}
+	FlatVector::GetData<data_ptr_t>(states)[0] = GetSlot(open_slot);
+	chunk.SetCardinality(1);
+	FinalizeStates(states, chunk);
+	has_open = false;
+}
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	state.Sink(input, chunk);
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	state.Flush(chunk);
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+InsertionOrderPreservingMap<string> PhysicalStreamingAggregate::ParamsToString() const {
+	InsertionOrderPreservingMap<string> result;
+	string groups_info;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			groups_info += "\n";
+		}
+		groups_info += groups[i]->GetName();
+	}
+	result["Groups"] = groups_info;
+
+	string aggregate_info;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0) {
+			aggregate_info += "\n";
+		}
+		aggregate_info += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			aggregate_info += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	result["Aggregates"] = aggregate_info;
+	return result;
+}
+
+} // namespace duckdb
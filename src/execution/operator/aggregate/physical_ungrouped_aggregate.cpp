@@ -259,8 +259,8 @@ void PhysicalUngroupedAggregate::SinkDistinct(ExecutionContext &context, DataChu
 		auto &aggregate = aggregates[idx]->Cast<BoundAggregateExpression>();
 
 		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
-			// This distinct aggregate shares its data with another
+		if (!distinct_data->radix_tables[table_idx] || !distinct_info.OwnsTable(idx)) {
+			// This distinct aggregate shares its data with a previous aggregate, which already sinks into the table
 			continue;
 		}
 		D_ASSERT(distinct_data->radix_tables[table_idx]);
@@ -457,17 +457,9 @@ void UngroupedDistinctAggregateFinalizeEvent::Schedule() {
 	auto &distinct_data = *op.distinct_data;
 
 	idx_t n_tasks = 0;
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
 	for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		// Forward the payload idx
-		payload_idx = next_payload_idx;
-		next_payload_idx = payload_idx + aggregate.children.size();
-
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
+		// If aggregate is not distinct, or its table is scanned for another aggregate, skip it
+		if (!distinct_data.IsDistinct(agg_idx) || !distinct_data.info.OwnsTable(agg_idx)) {
 			global_source_states.push_back(nullptr);
 			continue;
 		}
@@ -522,12 +514,14 @@ TaskExecutionResult UngroupedDistinctAggregateFinalizeTask::AggregateDistinct()
 	for (; agg_idx < aggregates.size(); agg_idx++) {
 		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
 
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
+		// If aggregate is not distinct, or its table is scanned for another aggregate, skip it
+		if (!distinct_data.IsDistinct(agg_idx) || !distinct_data.info.OwnsTable(agg_idx)) {
 			continue;
 		}
 
 		const auto table_idx = distinct_data.info.table_map.at(agg_idx);
+		// All aggregates with identical input are updated with a single scan of their table
+		const auto table_aggregates = distinct_data.info.TableAggregates(table_idx);
 		auto &radix_table = *distinct_data.radix_tables[table_idx];
 		if (!blocked) {
 			// Because we can block, we need to make sure we preserve this state
@@ -565,8 +559,10 @@ TaskExecutionResult UngroupedDistinctAggregateFinalizeTask::AggregateDistinct()
 			}
 			payload_chunk.SetCardinality(output_chunk);
 
-			// Update the aggregate state
-			state.Sink(payload_chunk, 0, agg_idx);
+			// Update the aggregate states
+			for (auto &table_agg_idx : table_aggregates) {
+				state.Sink(payload_chunk, 0, table_agg_idx);
+			}
 		}
 		blocked = false;
 	}
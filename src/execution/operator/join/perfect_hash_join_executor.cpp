@@ -17,7 +17,7 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin() {
 //===--------------------------------------------------------------------===//
 // Build
 //===--------------------------------------------------------------------===//
-bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::BuildPerfectHashTable() {
 	// First, allocate memory for each build column
 	auto build_size = perfect_join_statistics.build_range + 1;
 	for (const auto &type : join.rhs_output_types) {
@@ -30,10 +30,10 @@ bool PerfectHashJoinExecutor::BuildPerfectHashTable(LogicalType &key_type) {
 
 	// Now fill columns with build data
 
-	return FullScanHashTable(key_type);
+	return FullScanHashTable();
 }
 
-bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
+bool PerfectHashJoinExecutor::FullScanHashTable() {
 	auto &data_collection = ht.GetDataCollection();
 
 	// TODO: In a parallel finalize: One should exclusively lock and each thread should do one part of the code below.
@@ -49,23 +49,47 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	}
 
 	// Scan the build keys in the hash table
-	Vector build_vector(key_type, key_count);
-	RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vector, key_count, 0);
+	vector<Vector> build_vectors;
+	vector<reference<Vector>> build_keys;
+	build_vectors.reserve(ht.equality_types.size());
+	for (idx_t key_idx = 0; key_idx < ht.equality_types.size(); key_idx++) {
+		build_vectors.emplace_back(ht.equality_types[key_idx], key_count);
+		RowOperations::FullScanColumn(ht.layout, tuples_addresses, build_vectors.back(), key_count, key_idx);
+	}
+	for (auto &build_vector : build_vectors) {
+		build_keys.push_back(build_vector);
+	}
 
 	// Now fill the selection vector using the build keys and create a sequential vector
 	// TODO: add check for fast pass when probe is part of build domain
+	if (perfect_join_statistics.build_min.empty()) {
+		return false;
+	}
+	for (idx_t key_idx = 0; key_idx < build_keys.size(); key_idx++) {
+		if (perfect_join_statistics.build_min[key_idx].IsNull() ||
+		    perfect_join_statistics.build_max[key_idx].IsNull()) {
+			return false;
+		}
+	}
 	SelectionVector sel_build(key_count + 1);
 	SelectionVector sel_tuples(key_count + 1);
-	bool success = FillSelectionVectorSwitchBuild(build_vector, sel_build, sel_tuples, key_count);
-
-	// early out
-	if (!success) {
-		return false;
+	auto offsets = make_unsafe_uniq_array_uninitialized<idx_t>(key_count + 1);
+	// do not consider keys out of the range
+	auto in_domain_count = SelectInDomain(build_keys, key_count, sel_tuples, offsets.get());
+	for (idx_t i = 0; i < in_domain_count; i++) {
+		auto idx = offsets[sel_tuples.get_index(i)];
+		if (bitmap_build_idx[idx]) {
+			// early out: duplicate keys
+			return false;
+		}
+		bitmap_build_idx[idx] = true;
+		unique_keys++;
+		sel_build.set_index(i, idx);
 	}
 	if (unique_keys == perfect_join_statistics.build_range + 1 && !ht.has_null) {
 		perfect_join_statistics.is_build_dense = true;
 	}
-	key_count = unique_keys; // do not consider keys out of the range
+	key_count = unique_keys;
 
 	// Full scan the remaining build columns and fill the perfect hash table
 	const auto build_size = perfect_join_statistics.build_range + 1;
@@ -83,59 +107,88 @@ bool PerfectHashJoinExecutor::FullScanHashTable(LogicalType &key_type) {
 	return true;
 }
 
-bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec,
-                                                             SelectionVector &seq_sel_vec, idx_t count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		return TemplatedFillSelectionVectorBuild<int8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT16:
-		return TemplatedFillSelectionVectorBuild<int16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT32:
-		return TemplatedFillSelectionVectorBuild<int32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::INT64:
-		return TemplatedFillSelectionVectorBuild<int64_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT8:
-		return TemplatedFillSelectionVectorBuild<uint8_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT16:
-		return TemplatedFillSelectionVectorBuild<uint16_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT32:
-		return TemplatedFillSelectionVectorBuild<uint32_t>(source, sel_vec, seq_sel_vec, count);
-	case PhysicalType::UINT64:
-		return TemplatedFillSelectionVectorBuild<uint64_t>(source, sel_vec, seq_sel_vec, count);
-	default:
-		throw NotImplementedException("Type not supported for perfect hash join");
-	}
-}
-
 template <typename T>
-bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
-                                                                SelectionVector &seq_sel_vec, idx_t count) {
-	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
-		return false;
-	}
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
+static idx_t TemplatedSelectInDomain(Vector &source, idx_t count, const Value &min, const Value &max, idx_t stride,
+                                     bool first_key, SelectionVector &sel, idx_t sel_count, idx_t offsets[]) {
+	auto min_value = min.GetValueUnsafe<T>();
+	auto max_value = max.GetValueUnsafe<T>();
+
 	UnifiedVectorFormat vector_data;
 	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	// generate the selection vector
-	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-		auto data_idx = vector_data.sel->get_index(i);
+	auto data = UnifiedVectorFormat::GetData<T>(vector_data);
+	auto &validity_mask = vector_data.validity;
+
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < sel_count; ++i) {
+		// the selection vector is compacted in place: the result index never exceeds the input index
+		auto row_idx = first_key ? i : sel.get_index(i);
+		auto data_idx = vector_data.sel->get_index(row_idx);
+		if (!validity_mask.RowIsValid(data_idx)) {
+			continue;
+		}
 		auto input_value = data[data_idx];
 		// add index to selection vector if value in the range
 		if (min_value <= input_value && input_value <= max_value) {
-			auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-			sel_vec.set_index(sel_idx, idx);
-			if (bitmap_build_idx[idx]) {
-				return false;
-			} else {
-				bitmap_build_idx[idx] = true;
-				unique_keys++;
-			}
-			seq_sel_vec.set_index(sel_idx++, i);
+			// subtract min value to get the idx position
+			auto offset = static_cast<idx_t>(input_value - min_value) * stride;
+			offsets[row_idx] = first_key ? offset : offsets[row_idx] + offset;
+			sel.set_index(result_count++, row_idx);
 		}
 	}
-	return true;
+	return result_count;
+}
+
+idx_t PerfectHashJoinExecutor::SelectInDomain(const vector<reference<Vector>> &keys, idx_t count, SelectionVector &sel,
+                                              idx_t offsets[]) const {
+	idx_t sel_count = count;
+	idx_t stride = 1;
+	for (idx_t key_idx = 0; key_idx < keys.size(); key_idx++) {
+		auto &source = keys[key_idx].get();
+		auto &min = perfect_join_statistics.build_min[key_idx];
+		auto &max = perfect_join_statistics.build_max[key_idx];
+		const auto first_key = key_idx == 0;
+		switch (source.GetType().InternalType()) {
+		case PhysicalType::INT8:
+			sel_count = TemplatedSelectInDomain<int8_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                            offsets);
+			break;
+		case PhysicalType::INT16:
+			sel_count = TemplatedSelectInDomain<int16_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                             offsets);
+			break;
+		case PhysicalType::INT32:
+			sel_count = TemplatedSelectInDomain<int32_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                             offsets);
+			break;
+		case PhysicalType::INT64:
+			sel_count = TemplatedSelectInDomain<int64_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                             offsets);
+			break;
+		case PhysicalType::UINT8:
+			sel_count = TemplatedSelectInDomain<uint8_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                             offsets);
+			break;
+		case PhysicalType::UINT16:
+			sel_count = TemplatedSelectInDomain<uint16_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                              offsets);
+			break;
+		case PhysicalType::UINT32:
+			sel_count = TemplatedSelectInDomain<uint32_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                              offsets);
+			break;
+		case PhysicalType::UINT64:
+			sel_count = TemplatedSelectInDomain<uint64_t>(source, count, min, max, stride, first_key, sel, sel_count,
+			                                              offsets);
+			break;
+		default:
+			throw NotImplementedException("Type not supported for perfect hash join");
+		}
+		// the range of each key (and their product) was checked when planning the perfect hash join
+		auto min_value = min.GetValue<int64_t>();
+		auto max_value = max.GetValue<int64_t>();
+		stride *= NumericCast<idx_t>(max_value - min_value) + 1;
+	}
+	return sel_count;
 }
 
 //===--------------------------------------------------------------------===//
@@ -158,6 +211,8 @@ public:
 	SelectionVector build_sel_vec;
 	SelectionVector probe_sel_vec;
 	SelectionVector seq_sel_vec;
+	//! The offsets of the probe keys in the perfect hash table
+	idx_t offsets[STANDARD_VECTOR_SIZE];
 };
 
 unique_ptr<OperatorState> PerfectHashJoinExecutor::GetOperatorState(ExecutionContext &context) {
@@ -175,10 +230,23 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	state.join_keys.Reset();
 	state.probe_executor.Execute(input, state.join_keys);
 	// select the keys that are in the min-max range
-	auto &keys_vec = state.join_keys.data[0];
+	vector<reference<Vector>> keys;
+	for (auto &key : state.join_keys.data) {
+		keys.push_back(key);
+	}
 	auto keys_count = state.join_keys.size();
 	// todo: add check for fast pass when probe is part of build domain
-	FillSelectionVectorSwitchProbe(keys_vec, state.build_sel_vec, state.probe_sel_vec, keys_count, probe_sel_count);
+	auto in_domain_count = SelectInDomain(keys, keys_count, state.seq_sel_vec, state.offsets);
+	for (idx_t i = 0; i < in_domain_count; i++) {
+		auto row_idx = state.seq_sel_vec.get_index(i);
+		auto idx = state.offsets[row_idx];
+		// check for matches in the build
+		if (bitmap_build_idx[idx]) {
+			state.build_sel_vec.set_index(probe_sel_count, idx);
+			state.probe_sel_vec.set_index(probe_sel_count, row_idx);
+			probe_sel_count++;
+		}
+	}
 
 	// If build is dense and probe is in build's domain, just reference probe
 	if (perfect_join_statistics.is_build_dense && keys_count == probe_sel_count) {
@@ -198,87 +266,4 @@ OperatorResultType PerfectHashJoinExecutor::ProbePerfectHashTable(ExecutionConte
 	return OperatorResultType::NEED_MORE_INPUT;
 }
 
-void PerfectHashJoinExecutor::FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                             SelectionVector &probe_sel_vec, idx_t count,
-                                                             idx_t &probe_sel_count) {
-	switch (source.GetType().InternalType()) {
-	case PhysicalType::INT8:
-		TemplatedFillSelectionVectorProbe<int8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFillSelectionVectorProbe<int16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFillSelectionVectorProbe<int32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFillSelectionVectorProbe<int64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFillSelectionVectorProbe<uint8_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFillSelectionVectorProbe<uint16_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFillSelectionVectorProbe<uint32_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFillSelectionVectorProbe<uint64_t>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
-		break;
-	default:
-		throw NotImplementedException("Type not supported");
-	}
-}
-
-template <typename T>
-void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-                                                                SelectionVector &probe_sel_vec, idx_t count,
-                                                                idx_t &probe_sel_count) {
-	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
-	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
-
-	UnifiedVectorFormat vector_data;
-	source.ToUnifiedFormat(count, vector_data);
-	auto data = reinterpret_cast<T *>(vector_data.data);
-	auto validity_mask = &vector_data.validity;
-	// build selection vector for non-dense build
-	if (validity_mask->AllValid()) {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	} else {
-		for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
-			// retrieve value from vector
-			auto data_idx = vector_data.sel->get_index(i);
-			if (!validity_mask->RowIsValid(data_idx)) {
-				continue;
-			}
-			auto input_value = data[data_idx];
-			// add index to selection vector if value in the range
-			if (min_value <= input_value && input_value <= max_value) {
-				auto idx = (idx_t)(input_value - min_value); // subtract min value to get the idx position
-				                                             // check for matches in the build
-				if (bitmap_build_idx[idx]) {
-					build_sel_vec.set_index(sel_idx, idx);
-					probe_sel_vec.set_index(sel_idx++, i);
-					probe_sel_count++;
-				}
-			}
-		}
-	}
-}
-
 } // namespace duckdb
@@ -6,6 +6,7 @@
 #include "duckdb/common/sort/comparators.hpp"
 #include "duckdb/common/sort/partition_state.hpp"
 #include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/join/outer_join_marker.hpp"
@@ -17,11 +18,51 @@
 
 namespace duckdb {
 
+static bool AsOfCanStream(const PhysicalAsOfJoin &op) {
+	//	Only the asof comparison: the RHS is a single sorted run
+	if (!op.lhs_partitions.empty()) {
+		return false;
+	}
+	switch (op.join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+	case JoinType::RIGHT:
+	case JoinType::OUTER:
+	case JoinType::SEMI:
+	case JoinType::ANTI:
+		break;
+	default:
+		return false;
+	}
+	//	Keys we can compare directly in sort order
+	const auto &key_type = op.lhs_orders[0].expression->return_type;
+	if (key_type.id() == LogicalTypeId::TIME_TZ) {
+		return false;
+	}
+	switch (key_type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
 PhysicalAsOfJoin::PhysicalAsOfJoin(LogicalComparisonJoin &op, unique_ptr<PhysicalOperator> left,
                                    unique_ptr<PhysicalOperator> right)
     : PhysicalComparisonJoin(op, PhysicalOperatorType::ASOF_JOIN, std::move(op.conditions), op.join_type,
                              op.estimated_cardinality),
-      comparison_type(ExpressionType::INVALID) {
+      comparison_type(ExpressionType::INVALID), stream_ordered(false) {
 
 	// Convert the conditions partitions and sorts
 	for (auto &cond : conditions) {
@@ -72,6 +113,8 @@ PhysicalAsOfJoin::PhysicalAsOfJoin(LogicalComparisonJoin &op, unique_ptr<Physica
 			right_projection_map.emplace_back(i);
 		}
 	}
+
+	stream_ordered = AsOfCanStream(*this);
 }
 
 //===--------------------------------------------------------------------===//
@@ -180,7 +223,8 @@ SinkFinalizeType PhysicalAsOfJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 //===--------------------------------------------------------------------===//
 class AsOfGlobalState : public GlobalOperatorState {
 public:
-	explicit AsOfGlobalState(AsOfGlobalSinkState &gsink) {
+	AsOfGlobalState(ClientContext &context, const PhysicalAsOfJoin &op, AsOfGlobalSinkState &gsink)
+	    : context(context), op(op), gsink(gsink), stream_ready(false), rhs_key_count(0) {
 		// for FULL/RIGHT OUTER JOIN, initialize right_outers to false for every tuple
 		auto &rhs_partition = gsink.rhs_sink;
 		auto &right_outers = gsink.right_outers;
@@ -190,18 +234,93 @@ public:
 			right_outers.back().Initialize(hash_group->count);
 		}
 	}
+
+	//! Materialise the sorted RHS for joining ordered LHS chunks
+	void InitializeStream();
+
+	ClientContext &context;
+	const PhysicalAsOfJoin &op;
+	AsOfGlobalSinkState &gsink;
+
+	mutex stream_lock;
+	atomic<bool> stream_ready;
+	//! The non-NULL RHS keys in sort order
+	AllocatedData rhs_keys;
+	idx_t rhs_key_count;
+	//! The RHS payload in sort order
+	unique_ptr<ColumnDataCollection> rhs_data;
 };
 
+void AsOfGlobalState::InitializeStream() {
+	if (stream_ready) {
+		return;
+	}
+
+	lock_guard<mutex> guard(stream_lock);
+	if (stream_ready) {
+		return;
+	}
+
+	auto &rhs_sink = gsink.rhs_sink;
+	D_ASSERT(rhs_sink.hash_groups.size() == 1);
+	auto &global_sort = *rhs_sink.hash_groups[0]->global_sort;
+	auto &allocator = Allocator::Get(context);
+
+	rhs_data = make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), rhs_sink.payload_types);
+	if (!global_sort.sorted_blocks.empty()) {
+		//	The RHS is sorted with NULLS LAST, so the non-NULL keys are a prefix
+		const auto &key_expr = *op.rhs_orders[0].expression;
+		const auto key_width = GetTypeIdSize(key_expr.return_type.InternalType());
+		PayloadScanner scanner(global_sort, false);
+		rhs_keys = allocator.Allocate(scanner.Remaining() * key_width);
+
+		ExpressionExecutor executor(context, key_expr);
+		DataChunk payload;
+		payload.Initialize(allocator, rhs_sink.payload_types);
+		DataChunk keys;
+		keys.Initialize(allocator, {key_expr.return_type});
+		ColumnDataAppendState append_state;
+		rhs_data->InitializeAppend(append_state);
+		for (;;) {
+			payload.Reset();
+			scanner.Scan(payload);
+			const auto count = payload.size();
+			if (!count) {
+				break;
+			}
+
+			keys.Reset();
+			executor.Execute(payload, keys);
+			UnifiedVectorFormat kdata;
+			keys.data[0].ToUnifiedFormat(count, kdata);
+			for (idx_t i = 0; i < count; ++i) {
+				const auto kidx = kdata.sel->get_index(i);
+				if (!kdata.validity.RowIsValid(kidx)) {
+					continue;
+				}
+				D_ASSERT(rhs_key_count == rhs_data->Count() + i);
+				memcpy(rhs_keys.get() + rhs_key_count * key_width, kdata.data + kidx * key_width, key_width);
+				++rhs_key_count;
+			}
+
+			rhs_data->Append(append_state, payload);
+		}
+	}
+
+	stream_ready = true;
+}
+
 unique_ptr<GlobalOperatorState> PhysicalAsOfJoin::GetGlobalOperatorState(ClientContext &context) const {
 	auto &gsink = sink_state->Cast<AsOfGlobalSinkState>();
-	return make_uniq<AsOfGlobalState>(gsink);
+	return make_uniq<AsOfGlobalState>(context, *this, gsink);
 }
 
 class AsOfLocalState : public CachingOperatorState {
 public:
 	AsOfLocalState(ClientContext &context, const PhysicalAsOfJoin &op)
 	    : context(context), allocator(Allocator::Get(context)), op(op), lhs_executor(context),
-	      left_outer(IsLeftOuterJoin(op.join_type)), fetch_next_left(true) {
+	      left_outer(IsLeftOuterJoin(op.join_type)), fetch_next_left(true), stream_cursor(0),
+	      rhs_chunk_idx(DConstants::INVALID_INDEX) {
 		lhs_keys.Initialize(allocator, op.join_key_types);
 		for (const auto &cond : op.conditions) {
 			lhs_executor.AddExpression(*cond.left);
@@ -211,12 +330,19 @@ public:
 		lhs_sel.Initialize();
 		left_outer.Initialize(STANDARD_VECTOR_SIZE);
 
+		if (op.stream_ordered) {
+			rhs_chunk.Initialize(allocator, op.children[1]->types);
+		}
+
 		auto &gsink = op.sink_state->Cast<AsOfGlobalSinkState>();
 		lhs_partition_sink = gsink.RegisterBuffer(context);
 	}
 
 	bool Sink(DataChunk &input);
-	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk);
+	bool IsOrdered(idx_t count) const;
+	void StreamJoin(AsOfGlobalState &gstate, DataChunk &input, DataChunk &chunk);
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   AsOfGlobalState &gstate);
 
 	ClientContext &context;
 	Allocator &allocator;
@@ -232,14 +358,14 @@ public:
 	bool fetch_next_left;
 
 	optional_ptr<PartitionLocalSinkState> lhs_partition_sink;
+
+	//	Streaming ordered chunks
+	idx_t stream_cursor;
+	DataChunk rhs_chunk;
+	idx_t rhs_chunk_idx;
 };
 
 bool AsOfLocalState::Sink(DataChunk &input) {
-	//	Compute the join keys
-	lhs_keys.Reset();
-	lhs_executor.Execute(input, lhs_keys);
-	lhs_keys.Flatten();
-
 	//	Combine the NULLs
 	const auto count = input.size();
 	lhs_valid_mask.Reset();
@@ -295,8 +421,256 @@ bool AsOfLocalState::Sink(DataChunk &input) {
 	return false;
 }
 
-OperatorResultType AsOfLocalState::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk) {
+template <class T>
+static bool TemplatedAsOfIsOrdered(const Vector &keys, idx_t count) {
+	//	Either direction works, as the search starts from the previous match
+	const auto data = FlatVector::GetData<T>(keys);
+	const auto &validity = FlatVector::Validity(keys);
+	bool ascending = true;
+	bool descending = true;
+	auto prev = count;
+	for (idx_t i = 0; i < count && (ascending || descending); ++i) {
+		if (!validity.RowIsValid(i)) {
+			continue;
+		}
+		if (prev < count) {
+			ascending = ascending && LessThanEquals::Operation(data[prev], data[i]);
+			descending = descending && GreaterThanEquals::Operation(data[prev], data[i]);
+		}
+		prev = i;
+	}
+	return ascending || descending;
+}
+
+bool AsOfLocalState::IsOrdered(idx_t count) const {
+	auto &keys = lhs_keys.data[0];
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedAsOfIsOrdered<int8_t>(keys, count);
+	case PhysicalType::INT16:
+		return TemplatedAsOfIsOrdered<int16_t>(keys, count);
+	case PhysicalType::INT32:
+		return TemplatedAsOfIsOrdered<int32_t>(keys, count);
+	case PhysicalType::INT64:
+		return TemplatedAsOfIsOrdered<int64_t>(keys, count);
+	case PhysicalType::INT128:
+		return TemplatedAsOfIsOrdered<hugeint_t>(keys, count);
+	case PhysicalType::UINT8:
+		return TemplatedAsOfIsOrdered<uint8_t>(keys, count);
+	case PhysicalType::UINT16:
+		return TemplatedAsOfIsOrdered<uint16_t>(keys, count);
+	case PhysicalType::UINT32:
+		return TemplatedAsOfIsOrdered<uint32_t>(keys, count);
+	case PhysicalType::UINT64:
+		return TemplatedAsOfIsOrdered<uint64_t>(keys, count);
+	case PhysicalType::UINT128:
+		return TemplatedAsOfIsOrdered<uhugeint_t>(keys, count);
+	case PhysicalType::FLOAT:
+		return TemplatedAsOfIsOrdered<float>(keys, count);
+	case PhysicalType::DOUBLE:
+		return TemplatedAsOfIsOrdered<double>(keys, count);
+	default:
+		throw InternalException("Unsupported key type for streaming AsOf join");
+	}
+}
+
+//	OP(right, left) holds for a prefix of the sorted RHS. The match is the last row of that prefix.
+template <class T, class OP>
+static void AsOfStreamSearch(const Vector &keys, idx_t count, const T *rhs, idx_t rhs_count, idx_t &cursor,
+                             bool found_match[], idx_t matches[]) {
+	const auto data = FlatVector::GetData<T>(keys);
+	const auto &validity = FlatVector::Validity(keys);
+	for (idx_t i = 0; i < count; ++i) {
+		if (!validity.RowIsValid(i)) {
+			continue;
+		}
+
+		//	Exponential search from the previous position for the end of the matching prefix
+		const auto &key = data[i];
+		idx_t first;
+		idx_t last;
+		idx_t bound = 1;
+		if (cursor < rhs_count && OP::Operation(rhs[cursor], key)) {
+			first = last = cursor + 1;
+			while (last < rhs_count && OP::Operation(rhs[last], key)) {
+				first = last + 1;
+				last += bound;
+				bound *= 2;
+			}
+			last = MinValue(last, rhs_count);
+		} else {
+			first = last = cursor;
+			while (first > 0 && !OP::Operation(rhs[first - 1], key)) {
+				last = first - 1;
+				first = first > bound ? first - bound : 0;
+				bound *= 2;
+			}
+		}
+
+		//	Binary search for the first non-matching value
+		while (first < last) {
+			const auto mid = first + (last - first) / 2;
+			if (OP::Operation(rhs[mid], key)) {
+				first = mid + 1;
+			} else {
+				last = mid;
+			}
+		}
+		cursor = first;
+
+		if (first > 0) {
+			found_match[i] = true;
+			matches[i] = first - 1;
+		}
+	}
+}
+
+template <class T>
+static void TemplatedAsOfStreamSearch(ExpressionType comparison, const Vector &keys, idx_t count,
+                                      const AsOfGlobalState &gstate, idx_t &cursor, bool found_match[],
+                                      idx_t matches[]) {
+	const auto rhs = reinterpret_cast<const T *>(gstate.rhs_keys.get());
+	const auto rhs_count = gstate.rhs_key_count;
+	switch (comparison) {
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		AsOfStreamSearch<T, LessThanEquals>(keys, count, rhs, rhs_count, cursor, found_match, matches);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		AsOfStreamSearch<T, LessThan>(keys, count, rhs, rhs_count, cursor, found_match, matches);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		AsOfStreamSearch<T, GreaterThanEquals>(keys, count, rhs, rhs_count, cursor, found_match, matches);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		AsOfStreamSearch<T, GreaterThan>(keys, count, rhs, rhs_count, cursor, found_match, matches);
+		break;
+	default:
+		throw NotImplementedException("Unsupported comparison type for ASOF join");
+	}
+}
+
+static void AsOfStreamProbe(ExpressionType comparison, const Vector &keys, idx_t count, const AsOfGlobalState &gstate,
+                            idx_t &cursor, bool found_match[], idx_t matches[]) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedAsOfStreamSearch<int8_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::INT16:
+		return TemplatedAsOfStreamSearch<int16_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::INT32:
+		return TemplatedAsOfStreamSearch<int32_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::INT64:
+		return TemplatedAsOfStreamSearch<int64_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::INT128:
+		return TemplatedAsOfStreamSearch<hugeint_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::UINT8:
+		return TemplatedAsOfStreamSearch<uint8_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::UINT16:
+		return TemplatedAsOfStreamSearch<uint16_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::UINT32:
+		return TemplatedAsOfStreamSearch<uint32_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::UINT64:
+		return TemplatedAsOfStreamSearch<uint64_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::UINT128:
+		return TemplatedAsOfStreamSearch<uhugeint_t>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::FLOAT:
+		return TemplatedAsOfStreamSearch<float>(comparison, keys, count, gstate, cursor, found_match, matches);
+	case PhysicalType::DOUBLE:
+		return TemplatedAsOfStreamSearch<double>(comparison, keys, count, gstate, cursor, found_match, matches);
+	default:
+		throw InternalException("Unsupported key type for streaming AsOf join");
+	}
+}
+
+void AsOfLocalState::StreamJoin(AsOfGlobalState &gstate, DataChunk &input, DataChunk &chunk) {
+	const auto count = input.size();
+	bool found_match[STANDARD_VECTOR_SIZE] = {false};
+	idx_t matches[STANDARD_VECTOR_SIZE];
+	AsOfStreamProbe(op.comparison_type, lhs_keys.data[0], count, gstate, stream_cursor, found_match, matches);
+
+	switch (op.join_type) {
+	case JoinType::SEMI:
+		PhysicalJoin::ConstructSemiJoinResult(input, chunk, found_match);
+		return;
+	case JoinType::ANTI: {
+		//	Like the buffered rows, NULL keys are not emitted
+		auto &validity = FlatVector::Validity(lhs_keys.data[0]);
+		for (idx_t i = 0; i < count; ++i) {
+			found_match[i] = found_match[i] || !validity.RowIsValid(i);
+		}
+		PhysicalJoin::ConstructAntiJoinResult(input, chunk, found_match);
+		return;
+	}
+	default:
+		break;
+	}
+
+	//	Left joins emit every row, the others only the matches
+	const auto emit_all = IsLeftOuterJoin(op.join_type);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; ++i) {
+		if (emit_all || found_match[i]) {
+			lhs_sel.set_index(result_count++, i);
+		}
+	}
+	if (!result_count) {
+		return;
+	}
+
+	const auto left_column_count = input.ColumnCount();
+	for (column_t col_idx = 0; col_idx < left_column_count; ++col_idx) {
+		if (result_count == count) {
+			chunk.data[col_idx].Reference(input.data[col_idx]);
+		} else {
+			chunk.data[col_idx].Slice(input.data[col_idx], lhs_sel, result_count);
+		}
+	}
+
+	auto &right_outer = gstate.gsink.right_outers[0];
+	for (idx_t i = 0; i < result_count; ++i) {
+		const auto idx = lhs_sel.get_index(i);
+		if (!found_match[idx]) {
+			for (column_t col_idx = 0; col_idx < op.right_projection_map.size(); ++col_idx) {
+				FlatVector::SetNull(chunk.data[left_column_count + col_idx], i, true);
+			}
+			continue;
+		}
+
+		//	The RHS chunks are full, so the position determines the chunk
+		const auto match_pos = matches[idx];
+		right_outer.SetMatch(match_pos);
+		const auto chunk_idx = match_pos / STANDARD_VECTOR_SIZE;
+		if (chunk_idx != rhs_chunk_idx) {
+			rhs_chunk.Reset();
+			gstate.rhs_data->FetchChunk(chunk_idx, rhs_chunk);
+			rhs_chunk_idx = chunk_idx;
+		}
+		const auto source_offset = match_pos % STANDARD_VECTOR_SIZE;
+		for (column_t col_idx = 0; col_idx < op.right_projection_map.size(); ++col_idx) {
+			const auto rhs_idx = op.right_projection_map[col_idx];
+			auto &source = rhs_chunk.data[rhs_idx];
+			auto &target = chunk.data[left_column_count + col_idx];
+			VectorOperations::Copy(source, target, source_offset + 1, source_offset, i);
+		}
+	}
+	chunk.SetCardinality(result_count);
+}
+
+OperatorResultType AsOfLocalState::ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                   AsOfGlobalState &gstate) {
 	input.Verify();
+
+	//	Compute the join keys
+	lhs_keys.Reset();
+	lhs_executor.Execute(input, lhs_keys);
+	lhs_keys.Flatten();
+
+	//	Chunks that arrive in key order (e.g., sorted files) are joined directly
+	if (op.stream_ordered && IsOrdered(input.size())) {
+		gstate.InitializeStream();
+		StreamJoin(gstate, input, chunk);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
 	Sink(input);
 
 	//	If there were any unmatchable rows, return them now so we can forget about them.
@@ -325,7 +699,7 @@ OperatorResultType PhysicalAsOfJoin::ExecuteInternal(ExecutionContext &context,
 		}
 	}
 
-	return lstate.ExecuteInternal(context, input, chunk);
+	return lstate.ExecuteInternal(context, input, chunk, gstate.Cast<AsOfGlobalState>());
 }
 
 //===--------------------------------------------------------------------===//
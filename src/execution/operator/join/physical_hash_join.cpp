@@ -1,6 +1,8 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/types/value_map.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_functions.hpp"
@@ -14,6 +16,8 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -158,6 +162,8 @@ public:
 	idx_t total_size;
 	idx_t max_partition_size;
 	idx_t max_partition_count;
+	//! Whether the build side turned out to be much larger than the estimated cardinality of the probe side
+	bool build_exceeds_probe_estimate = false;
 
 	//! Hash tables built by each thread
 	vector<unique_ptr<JoinHashTable>> local_hash_tables;
@@ -420,7 +426,27 @@ public:
 		auto &ht = *sink.hash_table;
 		const auto chunk_count = ht.GetDataCollection().ChunkCount();
 		const auto num_threads = NumericCast<idx_t>(sink.num_threads);
-		if (num_threads == 1 || (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
+		if (ht.PointerTableIsPartitioned()) {
+			// Partition-wise finalize: every task inserts the chunks of a disjoint set of partitions, which end up in
+			// disjoint parts of the pointer table, so no atomics are needed
+			auto chunks_per_thread = MaxValue<idx_t>((chunk_count + num_threads - 1) / num_threads, 1);
+
+			idx_t partition_idx = 0;
+			while (partition_idx < ht.PartitionCount()) {
+				auto chunk_idx_from = ht.PartitionChunkOffset(partition_idx);
+				do {
+					partition_idx++;
+				} while (partition_idx < ht.PartitionCount() &&
+				         ht.PartitionChunkOffset(partition_idx + 1) - chunk_idx_from <= chunks_per_thread);
+				auto chunk_idx_to = ht.PartitionChunkOffset(partition_idx);
+				if (chunk_idx_from == chunk_idx_to) {
+					continue;
+				}
+				finalize_tasks.push_back(make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink,
+				                                                         chunk_idx_from, chunk_idx_to, false, sink.op));
+			}
+		} else if (num_threads == 1 ||
+		           (ht.Count() < PARALLEL_CONSTRUCT_THRESHOLD && !context.config.verify_parallelism)) {
 			// Single-threaded finalize
 			finalize_tasks.push_back(
 			    make_uniq<HashJoinFinalizeTask>(shared_from_this(), context, sink, 0U, chunk_count, false, sink.op));
@@ -456,7 +482,10 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 		hash_table->finalized = true;
 		return;
 	}
-	hash_table->InitializePointerTable();
+	// partition the pointer table if we finalize in parallel, so that each partition can be built independently
+	const auto parallel = num_threads > 1 && (hash_table->Count() >= HashJoinFinalizeEvent::PARALLEL_CONSTRUCT_THRESHOLD ||
+	                                          context.config.verify_parallelism);
+	hash_table->InitializePointerTable(parallel);
 	auto new_event = make_shared_ptr<HashJoinFinalizeEvent>(pipeline, *this);
 	event.InsertEvent(std::move(new_event));
 }
@@ -560,7 +589,215 @@ public:
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+void JoinFilterPushdownInfo::PushFilter(const JoinFilterPushdownColumn &filter, unique_ptr<TableFilter> table_filter,
+                                        const PhysicalOperator &op) const {
+	if (filter.null_values_are_equal) {
+		// NULL values can find a match - keep them regardless of the filter
+		auto or_filter = make_uniq<ConjunctionOrFilter>();
+		or_filter->child_filters.push_back(make_uniq<IsNullFilter>());
+		or_filter->child_filters.push_back(std::move(table_filter));
+		table_filter = std::move(or_filter);
+	}
+	dynamic_filters->PushFilter(op, filter.probe_column_index.column_index, std::move(table_filter));
+}
+
+void JoinFilterPushdownInfo::ScanBuildKeys(ClientContext &context, JoinHashTable &ht,
+                                           const vector<idx_t> &filter_indexes,
+                                           const std::function<void(DataChunk &keys)> &callback) const {
+	vector<column_t> column_ids;
+	for (auto &filter_idx : filter_indexes) {
+		// the build-side keys are stored in the same order as the join conditions
+		column_ids.push_back(filters[filter_idx].join_condition);
+	}
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, column_ids);
+	DataChunk scan_chunk;
+	data_collection.InitializeScanChunk(scan_state, scan_chunk);
+
+	vector<LogicalType> key_types;
+	vector<unique_ptr<ExpressionExecutor>> decompress_executors;
+	for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+		auto &filter = filters[filter_indexes[col_idx]];
+		if (filter.decompress_expression) {
+			key_types.push_back(filter.decompress_expression->return_type);
+			decompress_executors.push_back(make_uniq<ExpressionExecutor>(context, *filter.decompress_expression));
+		} else {
+			key_types.push_back(scan_chunk.data[col_idx].GetType());
+			decompress_executors.push_back(nullptr);
+		}
+	}
+	DataChunk compressed_key;
+	DataChunk keys;
+	keys.Initialize(Allocator::DefaultAllocator(), key_types);
+	while (data_collection.Scan(scan_state, scan_chunk)) {
+		keys.Reset();
+		for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
+			if (!decompress_executors[col_idx]) {
+				keys.data[col_idx].Reference(scan_chunk.data[col_idx]);
+				continue;
+			}
+			compressed_key.InitializeEmpty({scan_chunk.data[col_idx].GetType()});
+			compressed_key.data[0].Reference(scan_chunk.data[col_idx]);
+			compressed_key.SetCardinality(scan_chunk.size());
+			decompress_executors[col_idx]->ExecuteExpression(compressed_key, keys.data[col_idx]);
+		}
+		keys.SetCardinality(scan_chunk.size());
+		callback(keys);
+	}
+}
+
+Value JoinFilterPushdownInfo::GetMinMaxValue(ClientContext &context, DataChunk &final_min_max, idx_t aggr_idx) const {
+	auto value = final_min_max.data[aggr_idx].GetValue(0);
+	auto &filter = filters[aggr_idx / 2];
+	if (value.IsNull() || !filter.decompress_expression) {
+		return value;
+	}
+	DataChunk compressed_value;
+	compressed_value.InitializeEmpty({value.type()});
+	compressed_value.data[0].Reference(value);
+	compressed_value.SetCardinality(1);
+	Vector decompressed(filter.decompress_expression->return_type);
+	ExpressionExecutor executor(context, *filter.decompress_expression);
+	executor.ExecuteExpression(compressed_value, decompressed);
+	return decompressed.GetValue(0);
+}
+
+static void CollectBuildKeyValues(Vector &key_vector, idx_t count, value_set_t &result) {
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		auto value = key_vector.GetValue(row_idx);
+		if (!value.IsNull()) {
+			result.insert(std::move(value));
+		}
+	}
+}
+
+void JoinFilterPushdownInfo::PushMembershipFilters(ClientContext &context, JoinHashTable &ht,
+                                                   const vector<idx_t> &filter_indexes,
+                                                   const PhysicalOperator &op) const {
+	const auto build_count = ht.Count();
+	const bool push_in_filters = build_count <= DYNAMIC_IN_FILTER_THRESHOLD;
+	if (!push_in_filters && (!bloom_filter_pushdown || build_count > DYNAMIC_BLOOM_FILTER_THRESHOLD)) {
+		return;
+	}
+	vector<value_set_t> in_values(filter_indexes.size());
+	vector<shared_ptr<BlockedBloomFilter>> bloom_filters;
+	if (!push_in_filters) {
+		for (idx_t col_idx = 0; col_idx < filter_indexes.size(); col_idx++) {
+			bloom_filters.push_back(make_shared_ptr<BlockedBloomFilter>(build_count));
+		}
+	}
+
+	// scan the keys of the build side
+	ScanBuildKeys(context, ht, filter_indexes, [&](DataChunk &keys) {
+		for (idx_t col_idx = 0; col_idx < keys.ColumnCount(); col_idx++) {
+			if (push_in_filters) {
+				CollectBuildKeyValues(keys.data[col_idx], keys.size(), in_values[col_idx]);
+			} else {
+				bloom_filters[col_idx]->Insert(keys.data[col_idx], keys.size());
+			}
+		}
+	});
+
+	for (idx_t col_idx = 0; col_idx < filter_indexes.size(); col_idx++) {
+		auto &filter = filters[filter_indexes[col_idx]];
+		if (!push_in_filters) {
+			PushFilter(filter, make_uniq<BloomFilter>(std::move(bloom_filters[col_idx])), op);
+			continue;
+		}
+		// the build side is small - push the exact set of keys as an IN-list
+		auto in_filter = make_uniq<ConjunctionOrFilter>();
+		for (auto &value : in_values[col_idx]) {
+			in_filter->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, value));
+		}
+		PushFilter(filter, std::move(in_filter), op);
+	}
+}
+
+//! Whether or not the (non-NULL) build-side keys contain every integer value in [min_val, max_val]
+static bool BuildKeysAreDense(const Value &min_val, const Value &max_val, idx_t build_count,
+                              const std::function<void(const std::function<void(DataChunk &keys)> &)> &scan) {
+	switch (min_val.type().InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+		break;
+	default:
+		return false;
+	}
+	const auto min = min_val.GetValue<int64_t>();
+	const auto max = max_val.GetValue<int64_t>();
+	// the range can only be dense if the build side has at least as many keys as there are values in the range
+	const auto range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min);
+	if (range >= build_count) {
+		return false;
+	}
+	vector<bool> present(range + 1, false);
+	idx_t present_count = 0;
+	Vector bigint_keys(LogicalType::BIGINT);
+	scan([&](DataChunk &keys) {
+		VectorOperations::DefaultCast(keys.data[0], bigint_keys, keys.size());
+		UnifiedVectorFormat kdata;
+		bigint_keys.ToUnifiedFormat(keys.size(), kdata);
+		auto key_data = UnifiedVectorFormat::GetData<int64_t>(kdata);
+		for (idx_t i = 0; i < keys.size(); i++) {
+			auto idx = kdata.sel->get_index(i);
+			if (!kdata.validity.RowIsValid(idx)) {
+				continue;
+			}
+			auto offset = static_cast<uint64_t>(key_data[idx]) - static_cast<uint64_t>(min);
+			if (!present[offset]) {
+				present[offset] = true;
+				present_count++;
+			}
+		}
+	});
+	return present_count == range + 1;
+}
+
+void JoinFilterPushdownInfo::PushInvertedFilters(ClientContext &context, JoinHashTable &ht, DataChunk &final_min_max,
+                                                 const PhysicalOperator &op) const {
+	// inverted filters are only generated for a single equality condition
+	D_ASSERT(filters.size() == 1);
+	const vector<idx_t> filter_indexes {0};
+	auto scan = [&](const std::function<void(DataChunk & keys)> &callback) {
+		ScanBuildKeys(context, ht, filter_indexes, callback);
+	};
+	auto min_val = GetMinMaxValue(context, final_min_max, 0);
+	auto max_val = GetMinMaxValue(context, final_min_max, 1);
+	if (min_val.IsNull() || max_val.IsNull()) {
+		// all keys in the build side are NULL - every probe-side row is emitted
+		return;
+	}
+	// NULL values never find a match (or might find a match with IS NOT DISTINCT FROM) - we always keep them
+	auto result = make_uniq<ConjunctionOrFilter>();
+	result->child_filters.push_back(make_uniq<IsNullFilter>());
+	if (ht.Count() <= DYNAMIC_IN_FILTER_THRESHOLD) {
+		// the build side is small - remove all rows that are in the (exact) set of keys, i.e. push a NOT IN-list
+		value_set_t keys;
+		scan([&](DataChunk &chunk) { CollectBuildKeyValues(chunk.data[0], chunk.size(), keys); });
+		auto not_in_filter = make_uniq<ConjunctionAndFilter>();
+		for (auto &value : keys) {
+			not_in_filter->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_NOTEQUAL, value));
+		}
+		result->child_filters.push_back(std::move(not_in_filter));
+	} else if (BuildKeysAreDense(min_val, max_val, ht.Count(), scan)) {
+		// every value between min and max is in the build side - only rows outside of [min, max] can be emitted
+		result->child_filters.push_back(make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN, std::move(min_val)));
+		result->child_filters.push_back(
+		    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHAN, std::move(max_val)));
+	} else {
+		return;
+	}
+	dynamic_filters->PushFilter(op, filters[0].probe_column_index.column_index, std::move(result));
+}
+
+void JoinFilterPushdownInfo::PushFilters(ClientContext &context, JoinHashTable &ht, JoinFilterGlobalState &gstate,
+                                         const PhysicalOperator &op, bool push_membership_filters) const {
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -570,16 +807,20 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	final_min_max.Initialize(Allocator::DefaultAllocator(), min_max_types);
 
 	gstate.global_aggregate_state->Finalize(final_min_max);
+	if (inverted) {
+		PushInvertedFilters(context, ht, final_min_max, op);
+		return;
+	}
 
 	// create a filter for each of the aggregates
+	vector<idx_t> membership_filter_indexes;
 	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
 		auto &filter = filters[filter_idx];
-		auto filter_col_idx = filter.probe_column_index.column_index;
 		auto min_idx = filter_idx * 2;
 		auto max_idx = min_idx + 1;
 
-		auto min_val = final_min_max.data[min_idx].GetValue(0);
-		auto max_val = final_min_max.data[max_idx].GetValue(0);
+		auto min_val = GetMinMaxValue(context, final_min_max, min_idx);
+		auto max_val = GetMinMaxValue(context, final_min_max, max_idx);
 		if (min_val.IsNull() || max_val.IsNull()) {
 			// min/max is NULL
 			// this can happen in case all values in the RHS column are NULL, but they are still pushed into the hash
@@ -589,17 +830,24 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 		if (Value::NotDistinctFrom(min_val, max_val)) {
 			// min = max - generate an equality filter
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+			PushFilter(filter, std::move(constant_filter), op);
 		} else {
 			// min != max - generate a range filter
 			auto greater_equals =
 			    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(greater_equals));
+			PushFilter(filter, std::move(greater_equals), op);
 			auto less_equals = make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max_val));
-			dynamic_filters->PushFilter(op, filter_col_idx, std::move(less_equals));
+			PushFilter(filter, std::move(less_equals), op);
+			// the range can contain many values that are not in the build side - try to push the keys themselves
+			membership_filter_indexes.push_back(filter_idx);
 		}
-		// not null filter
-		dynamic_filters->PushFilter(op, filter_col_idx, make_uniq<IsNotNullFilter>());
+		if (!filter.null_values_are_equal) {
+			// not null filter
+			PushFilter(filter, make_uniq<IsNotNullFilter>(), op);
+		}
+	}
+	if (push_membership_filters && !membership_filter_indexes.empty()) {
+		PushMembershipFilters(context, ht, membership_filter_indexes, op);
 	}
 }
 
@@ -608,6 +856,20 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &ht = *sink.hash_table;
 
+	// the build side was chosen based on estimated cardinalities, check if the estimates were way off
+	idx_t build_count = 0;
+	for (auto &local_ht : sink.local_hash_tables) {
+		build_count += local_ht->GetSinkCollection().Count();
+	}
+	const auto probe_estimate = children[0]->estimated_cardinality;
+	sink.build_exceeds_probe_estimate = build_count >= BUILD_EXCEEDS_PROBE_MINIMUM_COUNT &&
+	                                    build_count / MaxValue<idx_t>(probe_estimate, 1) >= BUILD_EXCEEDS_PROBE_FACTOR;
+	if (sink.build_exceeds_probe_estimate) {
+		QueryProfiler::Get(context).AddExtraInfo(
+		    *this, "Build Exceeds Probe Estimate",
+		    StringUtil::Format("%llu rows (probe estimate: %llu rows)", build_count, probe_estimate));
+	}
+
 	sink.temporary_memory_state->UpdateReservation(context);
 	sink.external = sink.temporary_memory_state->GetReservation() < sink.total_size;
 	if (sink.external) {
@@ -646,15 +908,16 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		// membership filters only pay off if the probe side is large compared to the build side
+		filter_pushdown->PushFilters(context, ht, *sink.global_filter_state, *this,
+		                             !sink.build_exceeds_probe_estimate);
 	}
 
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
-		D_ASSERT(ht.equality_types.size() == 1);
-		auto key_type = ht.equality_types[0];
-		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable(key_type);
+		D_ASSERT(ht.equality_types.size() == conditions.size());
+		use_perfect_hash = sink.perfect_join_executor->BuildPerfectHashTable();
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
@@ -1215,11 +1478,11 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 	}
 
 	auto num_partitions = static_cast<double>(RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits()));
-	auto partition_start = static_cast<double>(sink.hash_table->GetPartitionStart());
-	auto partition_end = static_cast<double>(sink.hash_table->GetPartitionEnd());
+	auto current_partitions = static_cast<double>(sink.hash_table->GetCurrentPartitionCount());
+	auto completed_partitions = static_cast<double>(sink.hash_table->GetCompletedPartitionCount());
 
 	// This many partitions are fully done
-	auto progress = partition_start / num_partitions;
+	auto progress = (completed_partitions - current_partitions) / num_partitions;
 
 	auto probe_chunk_done = static_cast<double>(gstate.probe_chunk_done);
 	auto probe_chunk_count = static_cast<double>(gstate.probe_chunk_count);
@@ -1227,7 +1490,7 @@ double PhysicalHashJoin::GetProgress(ClientContext &context, GlobalSourceState &
 		// Progress of the current round of probing, weighed by the number of partitions
 		auto probe_progress = probe_chunk_done / probe_chunk_count;
 		// Add it to the progress, weighed by the number of partitions in the current round
-		progress += (partition_end - partition_start) / num_partitions * probe_progress;
+		progress += current_partitions / num_partitions * probe_progress;
 	}
 
 	return progress * 100.0;
@@ -1251,8 +1514,13 @@ InsertionOrderPreservingMap<string> PhysicalHashJoin::ParamsToString() const {
 
 	if (perfect_join_statistics.is_build_small) {
 		// perfect hash join
-		result["Build Min"] = perfect_join_statistics.build_min.ToString();
-		result["Build Max"] = perfect_join_statistics.build_max.ToString();
+		string build_min, build_max;
+		for (idx_t i = 0; i < perfect_join_statistics.build_min.size(); i++) {
+			build_min += (i > 0 ? ", " : "") + perfect_join_statistics.build_min[i].ToString();
+			build_max += (i > 0 ? ", " : "") + perfect_join_statistics.build_max[i].ToString();
+		}
+		result["Build Min"] = build_min;
+		result["Build Max"] = build_max;
 	}
 	SetEstimatedCardinality(result, estimated_cardinality);
 	return result;
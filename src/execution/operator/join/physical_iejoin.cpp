@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
@@ -9,6 +10,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/common/atomic.hpp"
@@ -171,8 +173,13 @@ SinkFinalizeType PhysicalIEJoin::Finalize(Pipeline &pipeline, Event &event, Clie
 		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
 	}
 
-	// Sort the current input child
-	table.Finalize(pipeline, event);
+	// Sort the current input child. The sorted blocks are range partitions on the first key, and every pair of
+	// partitions is joined independently, so we want enough of them to keep all threads busy
+	const auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	const auto partition_count = num_threads * PARTITIONS_PER_THREAD;
+	const auto max_block_capacity =
+	    MaxValue((table.Count() + partition_count - 1) / partition_count, MIN_PARTITION_SIZE);
+	table.Finalize(pipeline, event, max_block_capacity);
 
 	// Move to the next input child
 	++gstate.child;
@@ -788,11 +795,134 @@ void PhysicalIEJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &re
 	} while (result.size() == 0);
 }
 
+//! The range of the second join key in a sorted block
+struct IEJoinBlockBounds {
+	//! NULL if the block has no valid keys
+	Value min;
+	Value max;
+};
+
+template <class T>
+static void TemplatedComputeBlockBounds(GlobalSortState &gss, const idx_t block_idx, ExpressionExecutor &executor,
+                                        IEJoinBlockBounds &bounds) {
+	PayloadScanner scanner(gss, block_idx);
+	DataChunk scanned;
+	scanned.Initialize(Allocator::DefaultAllocator(), scanner.GetPayloadTypes());
+	DataChunk keys;
+	keys.Initialize(Allocator::DefaultAllocator(), {executor.expressions[0]->return_type});
+
+	T min = T();
+	T max = T();
+	bool has_valid = false;
+	for (;;) {
+		scanned.Reset();
+		scanner.Scan(scanned);
+		const auto count = scanned.size();
+		if (!count) {
+			break;
+		}
+
+		keys.Reset();
+		executor.Execute(scanned, keys);
+		UnifiedVectorFormat kdata;
+		keys.data[0].ToUnifiedFormat(count, kdata);
+		const auto key_data = UnifiedVectorFormat::GetData<T>(kdata);
+		for (idx_t i = 0; i < count; ++i) {
+			const auto idx = kdata.sel->get_index(i);
+			if (!kdata.validity.RowIsValid(idx)) {
+				continue;
+			}
+			const auto &key = key_data[idx];
+			if (!has_valid) {
+				min = key;
+				max = key;
+				has_valid = true;
+			} else if (LessThan::Operation(key, min)) {
+				min = key;
+			} else if (GreaterThan::Operation(key, max)) {
+				max = key;
+			}
+		}
+	}
+
+	if (has_valid) {
+		bounds.min = Value::CreateValue(min);
+		bounds.max = Value::CreateValue(max);
+	}
+}
+
+//! Computes the bounds of the key of a block, returns false if the key type does not support bounds
+static bool ComputeBlockBounds(ClientContext &context, GlobalSortState &gss, const idx_t block_idx,
+                               const Expression &expr, IEJoinBlockBounds &bounds) {
+	ExpressionExecutor executor(context, expr);
+	switch (expr.return_type.InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedComputeBlockBounds<int8_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::INT16:
+		TemplatedComputeBlockBounds<int16_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::INT32:
+		TemplatedComputeBlockBounds<int32_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::INT64:
+		TemplatedComputeBlockBounds<int64_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::INT128:
+		TemplatedComputeBlockBounds<hugeint_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedComputeBlockBounds<uint8_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedComputeBlockBounds<uint16_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedComputeBlockBounds<uint32_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedComputeBlockBounds<uint64_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedComputeBlockBounds<uhugeint_t>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedComputeBlockBounds<float>(gss, block_idx, executor, bounds);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedComputeBlockBounds<double>(gss, block_idx, executor, bounds);
+		break;
+	default:
+		return false;
+	}
+	return true;
+}
+
+static bool SupportsBlockBounds(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
 class IEJoinGlobalSourceState : public GlobalSourceState {
 public:
 	explicit IEJoinGlobalSourceState(const PhysicalIEJoin &op, IEJoinGlobalState &gsink)
-	    : op(op), gsink(gsink), initialized(false), next_pair(0), completed(0), left_outers(0), next_left(0),
-	      right_outers(0), next_right(0) {
+	    : op(op), gsink(gsink), initialized(false), pair_count(0), next_pair(0), completed(0), has_bounds(false),
+	      next_bounds(0), bounded(0), left_outers(0), next_left(0), right_outers(0), next_right(0) {
 	}
 
 	void Initialize() {
@@ -820,6 +950,45 @@ public:
 			right_base += right_table.BlockSize(rhs);
 		}
 
+		// Both tables are sorted on the first key, so their blocks are range partitions of it.
+		// For each left block, the right blocks that can satisfy the first condition form a suffix
+		// that only shrinks as we move to later left blocks.
+		const auto &cmp1 = op.conditions[0].comparison;
+		SBIterator bounds1(left_table.global_sort_state, cmp1);
+		SBIterator bounds2(right_table.global_sort_state, cmp1);
+		idx_t right_begin = 0;
+		pair_offsets.emplace_back(0);
+		for (idx_t lhs = 0; lhs < left_blocks; ++lhs) {
+			if (!left_table.BlockSize(lhs)) {
+				right_begins.emplace_back(right_blocks);
+				pair_offsets.emplace_back(pair_offsets.back());
+				continue;
+			}
+			// t1.X[0] op1 t2.X'[-1]
+			bounds1.SetIndex(bounds1.block_capacity * lhs);
+			for (; right_begin < right_blocks; ++right_begin) {
+				const auto right_size = right_table.BlockSize(right_begin);
+				if (!right_size) {
+					continue;
+				}
+				bounds2.SetIndex(bounds2.block_capacity * right_begin + right_size - 1);
+				if (bounds1.Compare(bounds2)) {
+					break;
+				}
+			}
+			right_begins.emplace_back(right_begin);
+			pair_offsets.emplace_back(pair_offsets.back() + right_blocks - right_begin);
+		}
+		pair_count = pair_offsets.back();
+
+		// The blocks are not sorted on the second key, so we compute its range for every block
+		// to skip the pairs that cannot satisfy the second condition
+		has_bounds = SupportsBlockBounds(op.lhs_orders[1].expression->return_type);
+		if (has_bounds) {
+			left_bounds.resize(left_blocks);
+			right_bounds.resize(right_blocks);
+		}
+
 		// Outer join block counts
 		if (left_table.found_match) {
 			left_outers = left_blocks;
@@ -840,19 +1009,67 @@ public:
 		return sink_state.tables[0]->BlockCount() * sink_state.tables[1]->BlockCount();
 	}
 
+	//! Whether the second key ranges of the pair of blocks can satisfy the second condition
+	bool BlocksOverlap(const idx_t b1, const idx_t b2) const {
+		if (!has_bounds) {
+			return true;
+		}
+		auto &left = left_bounds[b1];
+		auto &right = right_bounds[b2];
+		if (left.min.IsNull() || right.min.IsNull()) {
+			return false;
+		}
+		// t1.Y op2 t2.Y'
+		switch (op.conditions[1].comparison) {
+		case ExpressionType::COMPARE_LESSTHAN:
+			return left.min < right.max;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			return left.min <= right.max;
+		case ExpressionType::COMPARE_GREATERTHAN:
+			return left.max > right.min;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return left.max >= right.min;
+		default:
+			return true;
+		}
+	}
+
 	void GetNextPair(ClientContext &client, IEJoinLocalSourceState &lstate) {
 		auto &left_table = *gsink.tables[0];
 		auto &right_table = *gsink.tables[1];
 
 		const auto left_blocks = left_table.BlockCount();
 		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
+
+		// Compute the second key bounds of all blocks in parallel
+		if (has_bounds) {
+			const auto block_count = left_blocks + right_blocks;
+			for (auto b = next_bounds++; b < block_count; b = next_bounds++) {
+				if (b < left_blocks) {
+					ComputeBlockBounds(client, left_table.global_sort_state, b, *op.lhs_orders[1].expression,
+					                   left_bounds[b]);
+				} else {
+					ComputeBlockBounds(client, right_table.global_sort_state, b - left_blocks,
+					                   *op.rhs_orders[1].expression, right_bounds[b - left_blocks]);
+				}
+				++bounded;
+			}
+
+			// Spin wait for the other blocks to finish(!)
+			while (bounded < block_count) {
+				std::this_thread::yield();
+			}
+		}
 
 		// Regular block
-		const auto i = next_pair++;
-		if (i < pair_count) {
-			const auto b1 = i / right_blocks;
-			const auto b2 = i % right_blocks;
+		for (auto i = next_pair++; i < pair_count; i = next_pair++) {
+			const auto offset = std::upper_bound(pair_offsets.begin(), pair_offsets.end(), i) - pair_offsets.begin();
+			const auto b1 = NumericCast<idx_t>(offset - 1);
+			const auto b2 = right_begins[b1] + i - pair_offsets[b1];
+			if (!BlocksOverlap(b1, b2)) {
+				++completed;
+				continue;
+			}
 
 			lstate.left_block_index = b1;
 			lstate.left_base = left_bases[b1];
@@ -912,13 +1129,6 @@ public:
 	}
 
 	double GetProgress() const {
-		auto &left_table = *gsink.tables[0];
-		auto &right_table = *gsink.tables[1];
-
-		const auto left_blocks = left_table.BlockCount();
-		const auto right_blocks = right_table.BlockCount();
-		const auto pair_count = left_blocks * right_blocks;
-
 		const auto count = pair_count + left_outers + right_outers;
 
 		const auto l = MinValue(next_left.load(), left_outers.load());
@@ -934,6 +1144,7 @@ public:
 	bool initialized;
 
 	// Join queue state
+	atomic<idx_t> pair_count;
 	atomic<size_t> next_pair;
 	atomic<size_t> completed;
 
@@ -941,6 +1152,17 @@ public:
 	vector<idx_t> left_bases;
 	vector<idx_t> right_bases;
 
+	// The first right block that can join each left block, and the pair offset of each left block
+	vector<idx_t> right_begins;
+	vector<idx_t> pair_offsets;
+
+	// Block bounds on the second key
+	bool has_bounds;
+	vector<IEJoinBlockBounds> left_bounds;
+	vector<IEJoinBlockBounds> right_bounds;
+	atomic<idx_t> next_bounds;
+	atomic<idx_t> bounded;
+
 	// Outer joins
 	atomic<idx_t> left_outers;
 	atomic<idx_t> next_left;
@@ -1,14 +1,18 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 
@@ -149,6 +153,88 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! The column referenced by a projection expression that keeps the order of the rows. Compressed materialization
+//! wraps sorted columns in (de)compression functions, which are injective and preserve the order.
+static optional_idx GetOrderPreservingColumn(const Expression &expr) {
+	reference<const Expression> current(expr);
+	while (current.get().expression_class == ExpressionClass::BOUND_FUNCTION) {
+		auto &func = current.get().Cast<BoundFunctionExpression>();
+		if (func.children.empty() || (!StringUtil::StartsWith(func.function.name, "__internal_compress_") &&
+		                              !StringUtil::StartsWith(func.function.name, "__internal_decompress_"))) {
+			return optional_idx();
+		}
+		current = *func.children[0];
+	}
+	if (current.get().type != ExpressionType::BOUND_REF) {
+		return optional_idx();
+	}
+	return current.get().Cast<BoundReferenceExpression>().index;
+}
+
+static bool IsClusteredOnGroups(const PhysicalOperator &plan, const vector<unique_ptr<Expression>> &groups) {
+	// the columns of the groups in the output of the current operator
+	vector<idx_t> columns;
+	for (auto &group : groups) {
+		if (group->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	// follow the group columns down to a sort, through operators that keep the order of the rows
+	reference<const PhysicalOperator> current(plan);
+	while (true) {
+		auto &op = current.get();
+		switch (op.type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &projection = op.Cast<PhysicalProjection>();
+			for (auto &column : columns) {
+				auto child_column = GetOrderPreservingColumn(*projection.select_list[column]);
+				if (!child_column.IsValid()) {
+					return false;
+				}
+				column = child_column.GetIndex();
+			}
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			break;
+		case PhysicalOperatorType::ORDER_BY: {
+			// the rows of a group are adjacent if the leading sort keys are exactly the group columns
+			auto &order = op.Cast<PhysicalOrder>();
+			unordered_set<idx_t> group_columns;
+			for (auto column : columns) {
+				group_columns.insert(order.projections[column]);
+			}
+			if (group_columns.size() > order.orders.size()) {
+				return false;
+			}
+			unordered_set<idx_t> order_columns;
+			for (idx_t order_idx = 0; order_idx < group_columns.size(); order_idx++) {
+				auto &expr = *order.orders[order_idx].expression;
+				if (expr.type != ExpressionType::BOUND_REF) {
+					return false;
+				}
+				order_columns.insert(expr.Cast<BoundReferenceExpression>().index);
+			}
+			return order_columns == group_columns;
+		}
+		default:
+			return false;
+		}
+		current = *op.children[0];
+	}
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op, const PhysicalOperator &plan) {
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (!PhysicalStreamingAggregate::CanStreamAggregates(op.expressions)) {
+		return false;
+	}
+	return IsClusteredOnGroups(plan, op.groups);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -178,9 +264,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// stream the groups if the input is ordered on them, otherwise use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (CanUseStreamingAggregate(op, *plan)) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -215,9 +304,20 @@ PhysicalPlanGenerator::ExtractAggregateExpressions(unique_ptr<PhysicalOperator>
 		expressions.push_back(std::move(group));
 		group = std::move(ref);
 	}
+	// identical children of DISTINCT aggregates are projected only once, so the aggregates can share a distinct table
+	vector<idx_t> distinct_children;
 	for (auto &aggr : aggregates) {
 		auto &bound_aggr = aggr->Cast<BoundAggregateExpression>();
 		for (auto &child : bound_aggr.children) {
+			if (bound_aggr.IsDistinct() && !child->IsVolatile()) {
+				auto entry = std::find_if(distinct_children.begin(), distinct_children.end(),
+				                          [&](const idx_t idx) { return expressions[idx]->Equals(*child); });
+				if (entry != distinct_children.end()) {
+					child = make_uniq<BoundReferenceExpression>(child->return_type, *entry);
+					continue;
+				}
+				distinct_children.push_back(expressions.size());
+			}
 			auto ref = make_uniq<BoundReferenceExpression>(child->return_type, expressions.size());
 			types.push_back(child->return_type);
 			expressions.push_back(std::move(child));
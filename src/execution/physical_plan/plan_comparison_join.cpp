@@ -47,12 +47,8 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 	if (op.join_type != JoinType::INNER) {
 		return;
 	}
-	// with one condition
-	if (op.conditions.size() != 1) {
-		return;
-	}
-	// with propagated statistics
-	if (op.join_stats.empty()) {
+	// with propagated statistics for every condition
+	if (op.join_stats.empty() || op.join_stats.size() != op.conditions.size() * 2) {
 		return;
 	}
 	for (auto &type : op.children[1]->types) {
@@ -81,46 +77,55 @@ void CheckForPerfectJoinOpt(LogicalComparisonJoin &op, PerfectHashJoinStats &joi
 		}
 	}
 
-	// and when the build range is smaller than the threshold
-	auto &stats_build = *op.join_stats[1].get(); // rhs stats
-	if (!NumericStats::HasMinMax(stats_build)) {
-		return;
-	}
-	int64_t min_value, max_value;
-	if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
-	    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
-		return;
-	}
-	if (max_value < min_value) {
-		// empty table
-		return;
-	}
-	int64_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return;
-	}
-
-	// Fill join_stats for invisible join
-	auto &stats_probe = *op.join_stats[0].get(); // lhs stats
-	if (!NumericStats::HasMinMax(stats_probe)) {
-		return;
-	}
-
 	// The max size our build must have to run the perfect HJ
 	const idx_t MAX_BUILD_SIZE = 1000000;
-	join_state.probe_min = NumericStats::Min(stats_probe);
-	join_state.probe_max = NumericStats::Max(stats_probe);
-	join_state.build_min = NumericStats::Min(stats_build);
-	join_state.build_max = NumericStats::Max(stats_build);
-	join_state.estimated_cardinality = op.estimated_cardinality;
-	join_state.build_range = NumericCast<idx_t>(build_range);
-	if (join_state.build_range > MAX_BUILD_SIZE) {
-		return;
-	}
-	if (NumericStats::Min(stats_build) <= NumericStats::Min(stats_probe) &&
-	    NumericStats::Max(stats_probe) <= NumericStats::Max(stats_build)) {
-		join_state.is_probe_in_domain = true;
+	// the keys are combined into a single offset, so the product of the ranges of all keys must be small
+	idx_t build_size = 1;
+	bool is_probe_in_domain = true;
+	for (idx_t cond_idx = 0; cond_idx < op.conditions.size(); cond_idx++) {
+		// and when the build range is smaller than the threshold
+		auto &stats_build = *op.join_stats[cond_idx * 2 + 1].get(); // rhs stats
+		if (!NumericStats::HasMinMax(stats_build)) {
+			return;
+		}
+		int64_t min_value, max_value;
+		if (!ExtractNumericValue(NumericStats::Min(stats_build), min_value) ||
+		    !ExtractNumericValue(NumericStats::Max(stats_build), max_value)) {
+			return;
+		}
+		if (max_value < min_value) {
+			// empty table
+			return;
+		}
+		int64_t build_range;
+		if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
+			return;
+		}
+		if (NumericCast<idx_t>(build_range) > MAX_BUILD_SIZE) {
+			return;
+		}
+		build_size *= NumericCast<idx_t>(build_range) + 1;
+		if (build_size > MAX_BUILD_SIZE + 1) {
+			return;
+		}
+
+		// Fill join_stats for invisible join
+		auto &stats_probe = *op.join_stats[cond_idx * 2].get(); // lhs stats
+		if (!NumericStats::HasMinMax(stats_probe)) {
+			return;
+		}
+		join_state.probe_min.push_back(NumericStats::Min(stats_probe));
+		join_state.probe_max.push_back(NumericStats::Max(stats_probe));
+		join_state.build_min.push_back(NumericStats::Min(stats_build));
+		join_state.build_max.push_back(NumericStats::Max(stats_build));
+		if (NumericStats::Min(stats_build) > NumericStats::Min(stats_probe) ||
+		    NumericStats::Max(stats_probe) > NumericStats::Max(stats_build)) {
+			is_probe_in_domain = false;
+		}
 	}
+	join_state.estimated_cardinality = op.estimated_cardinality;
+	join_state.build_range = build_size - 1;
+	join_state.is_probe_in_domain = is_probe_in_domain;
 	join_state.is_build_small = true;
 	return;
 }
@@ -1,14 +1,66 @@
+#include "duckdb/common/type_visitor.hpp"
+#include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/execution/radix_partitioned_hashtable.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+//! Beyond this, the aggregate would have to keep track of many values, while emitting most of its groups anyway
+static constexpr idx_t TOP_N_AGGREGATE_MAX_LIMIT = 10000;
+
+//! If the Top-N orders on an aggregate of a hash aggregate (e.g., GROUP BY k ORDER BY count(*) DESC LIMIT 10),
+//! the aggregate does not have to emit the groups that cannot make it into the Top-N
+static void PushTopNIntoAggregate(PhysicalOperator &plan, const BoundOrderByNode &order, const idx_t limit) {
+	if (limit == 0 || limit > TOP_N_AGGREGATE_MAX_LIMIT ||
+	    (order.type != OrderType::ASCENDING && order.type != OrderType::DESCENDING) ||
+	    order.expression->GetExpressionType() != ExpressionType::BOUND_REF) {
+		return;
+	}
+	// Follow the column through the projections
+	auto column_idx = order.expression->Cast<BoundReferenceExpression>().index;
+	reference<PhysicalOperator> child(plan);
+	while (child.get().type == PhysicalOperatorType::PROJECTION) {
+		auto &expr = *child.get().Cast<PhysicalProjection>().select_list[column_idx];
+		if (expr.GetExpressionType() != ExpressionType::BOUND_REF) {
+			return;
+		}
+		column_idx = expr.Cast<BoundReferenceExpression>().index;
+		child = *child.get().children[0];
+	}
+	if (child.get().type != PhysicalOperatorType::HASH_GROUP_BY) {
+		return;
+	}
+
+	auto &aggregate = child.get().Cast<PhysicalHashAggregate>();
+	auto &data = aggregate.grouped_aggregate_data;
+	if (column_idx < data.GroupCount() || column_idx >= data.GroupCount() + data.aggregates.size()) {
+		return; // Not an aggregate
+	}
+	const auto aggregate_idx = column_idx - data.GroupCount();
+	if (!RadixPartitionedHashTable::SupportsTopN(data.aggregate_return_types[aggregate_idx])) {
+		return;
+	}
+	for (auto &group_type : data.group_types) {
+		if (TypeVisitor::Contains(group_type, LogicalTypeId::ARRAY)) {
+			return; // Gathering these requires a cast vector
+		}
+	}
+	data.top_n = make_uniq<AggregateTopN>(AggregateTopN {aggregate_idx, order.type, limit});
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
 	auto plan = CreatePlan(*op.children[0]);
 
+	if (op.limit <= TOP_N_AGGREGATE_MAX_LIMIT && op.offset <= TOP_N_AGGREGATE_MAX_LIMIT) {
+		PushTopNIntoAggregate(*plan, op.orders[0], op.limit + op.offset);
+	}
+
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
 	top_n->children.push_back(std::move(plan));
@@ -1,5 +1,6 @@
 #include "duckdb/execution/radix_partitioned_hashtable.hpp"
 
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/row/tuple_data_collection.hpp"
@@ -139,6 +140,9 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If more than this fraction of the rows sunk into a thread-local HT create a new group, pre-aggregation does
+	//! not pay off, and we skip the HT lookups
+	static constexpr const double SKIP_LOOKUP_UNIQUE_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -186,6 +190,13 @@ public:
 	idx_t count_before_combining;
 	//! Maximum partition size if all unique
 	idx_t max_partition_size;
+
+	//! Number of rows sunk by all threads
+	idx_t sink_count;
+	//! Number of rows that were appended without pre-aggregating them
+	idx_t skipped_lookup_count;
+	//! Number of threads that stopped pre-aggregating
+	idx_t skipped_lookup_threads;
 };
 
 RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const RadixPartitionedHashTable &radix_ht_p)
@@ -193,7 +204,8 @@ RadixHTGlobalSinkState::RadixHTGlobalSinkState(ClientContext &context_p, const R
       radix_ht(radix_ht_p), config(context, *this), finalized(false), external(false), active_threads(0),
       number_of_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
       any_combined(false), finalize_done(0), scan_pin_properties(TupleDataPinProperties::DESTROY_AFTER_DONE),
-      count_before_combining(0), max_partition_size(0) {
+      count_before_combining(0), max_partition_size(0), sink_count(0), skipped_lookup_count(0),
+      skipped_lookup_threads(0) {
 
 	// Compute minimum reservation
 	auto block_alloc_size = BufferManager::GetBufferManager(context).GetBlockAllocSize();
@@ -330,9 +342,18 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Number of rows sunk into the HT
+	idx_t sink_count;
+	//! Number of rows that were appended to the HT without a lookup
+	idx_t skipped_lookup_count;
+	//! Number of rows and new groups since the HT was last reset, to measure the reduction of pre-aggregation
+	idx_t window_sink_count;
+	idx_t window_group_count;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), skipped_lookup_count(0), window_sink_count(0), window_group_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -449,7 +470,14 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	PopulateGroupChunk(group_chunk, chunk);
 
 	auto &ht = *lstate.ht;
-	ht.AddChunk(group_chunk, payload_input, filter);
+	const auto new_group_count = ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += chunk.size();
+	if (ht.SkipsLookups()) {
+		lstate.skipped_lookup_count += chunk.size();
+	} else {
+		lstate.window_sink_count += chunk.size();
+		lstate.window_group_count += new_group_count;
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
@@ -461,6 +489,18 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 		ht.ClearPointerTable();
 		ht.ResetCount();
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+		// The HT is full: if almost every row created a new group, pre-aggregating did not reduce the data.
+		// From now on we directly append the rows to the partitions, the groups are combined during Finalize
+		if (!ht.SkipsLookups()) {
+			const auto unique_fraction =
+			    static_cast<double>(lstate.window_group_count) / static_cast<double>(lstate.window_sink_count);
+			if (unique_fraction > RadixHTConfig::SKIP_LOOKUP_UNIQUE_THRESHOLD) {
+				ht.SkipLookups();
+			}
+		}
+		lstate.window_sink_count = 0;
+		lstate.window_group_count = 0;
 	}
 
 	// Check if we need to repartition
@@ -507,6 +547,12 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 		gstate.uncombined_data = std::move(lstate.abandoned_data);
 	}
 	gstate.stored_allocators.emplace_back(ht.GetAggregateAllocator());
+
+	gstate.sink_count += lstate.sink_count;
+	gstate.skipped_lookup_count += lstate.skipped_lookup_count;
+	if (ht.SkipsLookups()) {
+		gstate.skipped_lookup_threads++;
+	}
 }
 
 void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState &gstate_p) const {
@@ -547,6 +593,14 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 	gstate.finalized = true;
 }
 
+void RadixPartitionedHashTable::GetSkippedLookups(GlobalSinkState &gstate_p, idx_t &sink_count, idx_t &skipped_count,
+                                                  idx_t &skipped_threads) const {
+	auto &gstate = gstate_p.Cast<RadixHTGlobalSinkState>();
+	sink_count = gstate.sink_count;
+	skipped_count = gstate.skipped_lookup_count;
+	skipped_threads = gstate.skipped_lookup_threads;
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -602,6 +656,134 @@ public:
 
 enum class RadixHTScanStatus : uint8_t { INIT, IN_PROGRESS, DONE };
 
+//! Keeps the best values of the Top-N aggregate that this thread has emitted so far.
+//! A row whose value comes after all of them can never make it into the Top-N, so it does not have to be emitted
+class RadixHTTopNFilter {
+public:
+	RadixHTTopNFilter(const AggregateTopN &top_n, const LogicalType &type);
+
+	//! Selects the rows that can still make it into the Top-N, and returns how many there are
+	idx_t Select(Vector &input, const idx_t count, SelectionVector &sel);
+
+public:
+	const AggregateTopN &top_n;
+
+private:
+	template <class T>
+	idx_t TemplatedSelect(Vector &input, const idx_t count, SelectionVector &sel);
+	template <class T, class OP>
+	idx_t TemplatedSelect(Vector &input, const idx_t count, SelectionVector &sel);
+
+private:
+	const PhysicalType physical_type;
+	//! Heap of the best "limit" values, with the value that comes last in the Top-N on top
+	unsafe_unique_array<data_t> heap_data;
+	idx_t heap_size;
+};
+
+RadixHTTopNFilter::RadixHTTopNFilter(const AggregateTopN &top_n_p, const LogicalType &type)
+    : top_n(top_n_p), physical_type(type.InternalType()),
+      heap_data(make_unsafe_uniq_array_uninitialized<data_t>(top_n.limit * GetTypeIdSize(physical_type))),
+      heap_size(0) {
+	D_ASSERT(top_n.limit != 0);
+}
+
+bool RadixPartitionedHashTable::SupportsTopN(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T, class OP>
+idx_t RadixHTTopNFilter::TemplatedSelect(Vector &input, const idx_t count, SelectionVector &sel) {
+	UnifiedVectorFormat format;
+	input.ToUnifiedFormat(count, format);
+	const auto data = UnifiedVectorFormat::GetData<T>(format);
+
+	// OP::Operation(a, b) is true if "a" comes before "b" in the Top-N
+	const auto heap = reinterpret_cast<T *>(heap_data.get());
+	const auto comp = [](const T &a, const T &b) {
+		return OP::Operation(a, b);
+	};
+
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = format.sel->get_index(i);
+		if (!format.validity.RowIsValid(idx)) {
+			// We don't bother with NULLs, these are always emitted
+			sel.set_index(result_count++, i);
+			continue;
+		}
+		const auto &value = data[idx];
+		if (heap_size < top_n.limit) {
+			heap[heap_size++] = value;
+			std::push_heap(heap, heap + heap_size, comp);
+		} else if (OP::Operation(heap[0], value)) {
+			// We have already emitted "limit" values that come before this one
+			continue;
+		} else if (OP::Operation(value, heap[0])) {
+			std::pop_heap(heap, heap + heap_size, comp);
+			heap[heap_size - 1] = value;
+			std::push_heap(heap, heap + heap_size, comp);
+		}
+		sel.set_index(result_count++, i);
+	}
+	return result_count;
+}
+
+template <class T>
+idx_t RadixHTTopNFilter::TemplatedSelect(Vector &input, const idx_t count, SelectionVector &sel) {
+	if (top_n.type == OrderType::DESCENDING) {
+		return TemplatedSelect<T, GreaterThan>(input, count, sel);
+	}
+	return TemplatedSelect<T, LessThan>(input, count, sel);
+}
+
+idx_t RadixHTTopNFilter::Select(Vector &input, const idx_t count, SelectionVector &sel) {
+	switch (physical_type) {
+	case PhysicalType::INT8:
+		return TemplatedSelect<int8_t>(input, count, sel);
+	case PhysicalType::INT16:
+		return TemplatedSelect<int16_t>(input, count, sel);
+	case PhysicalType::INT32:
+		return TemplatedSelect<int32_t>(input, count, sel);
+	case PhysicalType::INT64:
+		return TemplatedSelect<int64_t>(input, count, sel);
+	case PhysicalType::INT128:
+		return TemplatedSelect<hugeint_t>(input, count, sel);
+	case PhysicalType::UINT8:
+		return TemplatedSelect<uint8_t>(input, count, sel);
+	case PhysicalType::UINT16:
+		return TemplatedSelect<uint16_t>(input, count, sel);
+	case PhysicalType::UINT32:
+		return TemplatedSelect<uint32_t>(input, count, sel);
+	case PhysicalType::UINT64:
+		return TemplatedSelect<uint64_t>(input, count, sel);
+	case PhysicalType::UINT128:
+		return TemplatedSelect<uhugeint_t>(input, count, sel);
+	case PhysicalType::FLOAT:
+		return TemplatedSelect<float>(input, count, sel);
+	case PhysicalType::DOUBLE:
+		return TemplatedSelect<double>(input, count, sel);
+	default:
+		throw NotImplementedException("Unimplemented type for RadixHTTopNFilter::Select");
+	}
+}
+
 class RadixHTLocalSourceState : public LocalSourceState {
 public:
 	explicit RadixHTLocalSourceState(ExecutionContext &context, const RadixPartitionedHashTable &radix_ht);
@@ -616,6 +798,8 @@ private:
 	//! Execute the finalize or scan task
 	void Finalize(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate);
 	void Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate, DataChunk &chunk);
+	//! Finalizes (and gathers the groups of) only the scanned rows that can make it into the Top-N
+	void ScanTopN(RowOperationsState &row_state, const TupleDataCollection &data_collection);
 
 public:
 	//! Current task and index
@@ -635,6 +819,11 @@ private:
 	//! State and chunk for scanning
 	TupleDataScanState scan_state;
 	DataChunk scan_chunk;
+
+	//! Filter for the rows that can make it into the Top-N (if any), the selected rows, and their locations
+	unique_ptr<RadixHTTopNFilter> top_n_filter;
+	SelectionVector top_n_sel;
+	Vector top_n_locations;
 };
 
 unique_ptr<GlobalSourceState> RadixPartitionedHashTable::GetGlobalSourceState(ClientContext &context) const {
@@ -685,13 +874,18 @@ SourceResultType RadixHTGlobalSourceState::AssignTask(RadixHTGlobalSinkState &si
 
 RadixHTLocalSourceState::RadixHTLocalSourceState(ExecutionContext &context, const RadixPartitionedHashTable &radix_ht)
     : task(RadixHTSourceTaskType::NO_TASK), scan_status(RadixHTScanStatus::DONE), layout(radix_ht.GetLayout().Copy()),
-      aggregate_allocator(BufferAllocator::Get(context.client)) {
+      aggregate_allocator(BufferAllocator::Get(context.client)), top_n_locations(LogicalType::POINTER) {
 	auto &allocator = BufferAllocator::Get(context.client);
 	auto scan_chunk_types = radix_ht.group_types;
 	for (auto &aggr_type : radix_ht.op.aggregate_return_types) {
 		scan_chunk_types.push_back(aggr_type);
 	}
 	scan_chunk.Initialize(allocator, scan_chunk_types);
+	if (radix_ht.op.top_n) {
+		const auto &top_n = *radix_ht.op.top_n;
+		top_n_filter = make_uniq<RadixHTTopNFilter>(top_n, radix_ht.op.aggregate_return_types[top_n.aggregate_idx]);
+		top_n_sel.Initialize(STANDARD_VECTOR_SIZE);
+	}
 }
 
 void RadixHTLocalSourceState::ExecuteTask(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate,
@@ -770,6 +964,36 @@ void RadixHTLocalSourceState::Finalize(RadixHTGlobalSinkState &sink, RadixHTGlob
 	scan_status = RadixHTScanStatus::INIT;
 }
 
+void RadixHTLocalSourceState::ScanTopN(RowOperationsState &row_state, const TupleDataCollection &data_collection) {
+	const auto group_cols = layout.ColumnCount() - 1;
+	auto &row_locations = scan_state.chunk_state.row_locations;
+	const auto count = scan_chunk.size();
+	const auto &top_n = top_n_filter->top_n;
+
+	// Finalize only the aggregate that the Top-N orders on
+	auto &aggregates = layout.GetAggregates();
+	auto aggr_offset = layout.GetAggrOffset();
+	for (idx_t aggr_idx = 0; aggr_idx < top_n.aggregate_idx; aggr_idx++) {
+		aggr_offset += aggregates[aggr_idx].payload_size;
+	}
+	VectorOperations::Copy(row_locations, top_n_locations, count, 0, 0);
+	VectorOperations::AddInPlace(top_n_locations, UnsafeNumericCast<int64_t>(aggr_offset), count);
+	auto &aggr = aggregates[top_n.aggregate_idx];
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), row_state.allocator);
+	aggr.function.finalize(top_n_locations, aggr_input_data, scan_chunk.data[group_cols + top_n.aggregate_idx], count,
+	                       0);
+
+	// Finalize all aggregates, and gather the groups, only for the rows that can make it into the Top-N
+	const auto selected = top_n_filter->Select(scan_chunk.data[group_cols + top_n.aggregate_idx], count, top_n_sel);
+	VectorOperations::Copy(row_locations, top_n_locations, top_n_sel, selected, 0, 0);
+	scan_chunk.SetCardinality(selected);
+	RowOperations::FinalizeStates(row_state, layout, top_n_locations, scan_chunk, group_cols);
+	for (idx_t col_idx = 0; col_idx < group_cols; col_idx++) {
+		data_collection.Gather(top_n_locations, *FlatVector::IncrementalSelectionVector(), selected, col_idx,
+		                       scan_chunk.data[col_idx], *FlatVector::IncrementalSelectionVector(), nullptr);
+	}
+}
+
 void RadixHTLocalSourceState::Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSourceState &gstate, DataChunk &chunk) {
 	D_ASSERT(task == RadixHTSourceTaskType::SCAN);
 	D_ASSERT(scan_status != RadixHTScanStatus::DONE);
@@ -779,7 +1003,9 @@ void RadixHTLocalSourceState::Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSo
 	auto &data_collection = *partition.data;
 
 	if (scan_status == RadixHTScanStatus::INIT) {
-		data_collection.InitializeScan(scan_state, gstate.column_ids, sink.scan_pin_properties);
+		// With a Top-N, the groups are gathered only for the rows that can make it into the Top-N (see below)
+		data_collection.InitializeScan(scan_state, top_n_filter ? vector<column_t>() : gstate.column_ids,
+		                               sink.scan_pin_properties);
 		scan_status = RadixHTScanStatus::IN_PROGRESS;
 	}
 
@@ -797,10 +1023,16 @@ void RadixHTLocalSourceState::Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSo
 
 	RowOperationsState row_state(aggregate_allocator);
 	const auto group_cols = layout.ColumnCount() - 1;
-	RowOperations::FinalizeStates(row_state, layout, scan_state.chunk_state.row_locations, scan_chunk, group_cols);
+	auto &row_locations = scan_state.chunk_state.row_locations;
+	const auto count = scan_chunk.size();
+	if (top_n_filter) {
+		ScanTopN(row_state, data_collection);
+	} else {
+		RowOperations::FinalizeStates(row_state, layout, row_locations, scan_chunk, group_cols);
+	}
 
 	if (sink.scan_pin_properties == TupleDataPinProperties::DESTROY_AFTER_DONE && layout.HasDestructor()) {
-		RowOperations::DestroyStates(row_state, layout, scan_state.chunk_state.row_locations, scan_chunk.size());
+		RowOperations::DestroyStates(row_state, layout, row_locations, count);
 	}
 
 	auto &radix_ht = sink.radix_ht;
@@ -822,7 +1054,7 @@ void RadixHTLocalSourceState::Scan(RadixHTGlobalSinkState &sink, RadixHTGlobalSo
 		chunk.data[radix_ht.op.GroupCount() + radix_ht.op.aggregates.size() + i].Reference(radix_ht.grouping_values[i]);
 	}
 	chunk.SetCardinality(scan_chunk);
-	D_ASSERT(chunk.size() != 0);
+	D_ASSERT(chunk.size() != 0 || top_n_filter);
 }
 
 bool RadixHTLocalSourceState::TaskFinished() {
@@ -300,6 +300,8 @@ enum class SinkNextBatchType : uint8_t;
 
 enum class SinkResultType : uint8_t;
 
+enum class SketchType : uint8_t;
+
 enum class SourceResultType : uint8_t;
 
 enum class StatementReturnType : uint8_t;
@@ -761,6 +763,9 @@ const char* EnumUtil::ToChars<SinkNextBatchType>(SinkNextBatchType value);
 template<>
 const char* EnumUtil::ToChars<SinkResultType>(SinkResultType value);
 
+template<>
+const char* EnumUtil::ToChars<SketchType>(SketchType value);
+
 template<>
 const char* EnumUtil::ToChars<SourceResultType>(SourceResultType value);
 
@@ -1251,6 +1256,9 @@ SinkNextBatchType EnumUtil::FromString<SinkNextBatchType>(const char *value);
 template<>
 SinkResultType EnumUtil::FromString<SinkResultType>(const char *value);
 
+template<>
+SketchType EnumUtil::FromString<SketchType>(const char *value);
+
 template<>
 SourceResultType EnumUtil::FromString<SourceResultType>(const char *value);
 
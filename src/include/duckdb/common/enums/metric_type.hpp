@@ -58,6 +58,7 @@ enum class MetricsType : uint8_t {
     OPTIMIZER_TOP_N,
     OPTIMIZER_COMPRESSED_MATERIALIZATION,
     OPTIMIZER_DUPLICATE_GROUPS,
+    OPTIMIZER_GROUPING_SETS,
     OPTIMIZER_REORDER_FILTER,
     OPTIMIZER_JOIN_FILTER_PUSHDOWN,
     OPTIMIZER_EXTENSION,
@@ -34,6 +34,7 @@ enum class OptimizerType : uint32_t {
 	TOP_N,
 	COMPRESSED_MATERIALIZATION,
 	DUPLICATE_GROUPS,
+	GROUPING_SETS,
 	REORDER_FILTER,
 	JOIN_FILTER_PUSHDOWN,
 	EXTENSION,
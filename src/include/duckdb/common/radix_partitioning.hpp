@@ -51,9 +51,9 @@ public:
 		return (hash_t(1 << radix_bits) - 1) << Shift(radix_bits);
 	}
 
-	//! Select using a cutoff on the radix bits of the hash
-	static idx_t Select(Vector &hashes, const SelectionVector *sel, idx_t count, idx_t radix_bits, idx_t cutoff,
-	                    SelectionVector *true_sel, SelectionVector *false_sel);
+	//! Select the hashes whose radix bits map to a partition that is set in the partition mask
+	static idx_t Select(Vector &hashes, const SelectionVector *sel, idx_t count, idx_t radix_bits,
+	                    const ValidityMask &partition_mask, SelectionVector *true_sel, SelectionVector *false_sel);
 };
 
 //! RadixPartitionedColumnData is a PartitionedColumnData that partitions input based on the radix of a hash
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/blocked_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class Serializer;
+class Deserializer;
+
+//! A register-blocked Bloom filter over hash values
+//! Every hash maps to a single 64-bit block in which BITS_PER_HASH bits are set, so that a lookup is a single memory
+//! access. A lookup may return false positives, but never false negatives
+class BlockedBloomFilter {
+public:
+	//! The number of bits that are reserved in the filter per expected element
+	static constexpr const idx_t BITS_PER_ELEMENT = 16;
+	//! The number of bits that are set in a block per hash
+	static constexpr const idx_t BITS_PER_HASH = 4;
+
+public:
+	explicit BlockedBloomFilter(idx_t expected_count);
+	explicit BlockedBloomFilter(vector<uint64_t> blocks);
+
+public:
+	inline void InsertHash(hash_t hash) {
+		blocks[GetBlockIndex(hash)] |= GetBlockMask(hash);
+	}
+	inline bool LookupHash(hash_t hash) const {
+		auto mask = GetBlockMask(hash);
+		return (blocks[GetBlockIndex(hash)] & mask) == mask;
+	}
+
+	//! Inserts the (non-NULL) values of the input vector into the filter
+	void Insert(Vector &input, idx_t count);
+	//! Reduces the selection vector to the (non-NULL) rows of the input that might be in the filter, returns the count
+	idx_t Lookup(Vector &input, SelectionVector &sel, idx_t approved_tuple_count) const;
+
+	idx_t SizeInBytes() const {
+		return blocks.size() * sizeof(uint64_t);
+	}
+
+	void Serialize(Serializer &serializer) const;
+	static shared_ptr<BlockedBloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		return (hash >> 32) & block_mask;
+	}
+	static inline uint64_t GetBlockMask(hash_t hash) {
+		uint64_t mask = 0;
+		for (idx_t i = 0; i < BITS_PER_HASH; i++) {
+			mask |= uint64_t(1) << ((hash >> (i * 6)) & 63);
+		}
+		return mask;
+	}
+
+private:
+	//! The blocks of the filter (a power of two)
+	vector<uint64_t> blocks;
+	//! Mask to compute the block index of a hash
+	idx_t block_mask;
+};
+
+} // namespace duckdb
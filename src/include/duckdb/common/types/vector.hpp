@@ -320,6 +320,21 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The number of entries in the dictionary, if the dictionary is shared between vectors
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
+	//! The id of the dictionary (0 if the dictionary is not shared between vectors)
+	static inline idx_t DictionaryId(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionaryId();
+	}
+	//! Marks the dictionary of the vector as shared: every vector that is created with the same dictionary id must
+	//! reference the same (immutable) dictionary of the given size
+	DUCKDB_API static void SetDictionary(Vector &vector, idx_t dictionary_size, idx_t dictionary_id);
+	//! Creates a new, unique, dictionary id
+	DUCKDB_API static idx_t CreateDictionaryId();
 };
 
 struct FlatVector {
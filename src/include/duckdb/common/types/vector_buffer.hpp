@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/common/types/string_type.hpp"
@@ -159,9 +160,25 @@ public:
 	void SetSelVector(const SelectionVector &vector) {
 		this->sel_vector.Initialize(vector);
 	}
+	optional_idx GetDictionarySize() const {
+		return dictionary_size;
+	}
+	void SetDictionarySize(idx_t dictionary_size_p) {
+		dictionary_size = dictionary_size_p;
+	}
+	idx_t GetDictionaryId() const {
+		return dictionary_id;
+	}
+	void SetDictionaryId(idx_t dictionary_id_p) {
+		dictionary_id = dictionary_id_p;
+	}
 
 private:
 	SelectionVector sel_vector;
+	//! The number of entries in the dictionary (if known)
+	optional_idx dictionary_size;
+	//! Identifies the dictionary: all dictionary vectors with the same (non-zero) id have the same dictionary
+	idx_t dictionary_id = 0;
 };
 
 class VectorStringBuffer : public VectorBuffer {
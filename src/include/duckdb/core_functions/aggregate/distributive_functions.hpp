@@ -24,6 +24,24 @@ struct ApproxCountDistinctFun {
 	static AggregateFunction GetFunction();
 };
 
+struct ApproxCountDistinctStateFun {
+	static constexpr const char *Name = "approx_count_distinct_state";
+	static constexpr const char *Parameters = "any";
+	static constexpr const char *Description = "Computes a HyperLogLog sketch of the values as a BLOB, which can be stored and merged by approx_count_distinct_merge.";
+	static constexpr const char *Example = "approx_count_distinct_state(A)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ApproxCountDistinctMergeFun {
+	static constexpr const char *Name = "approx_count_distinct_merge";
+	static constexpr const char *Parameters = "state";
+	static constexpr const char *Description = "Merges the HyperLogLog sketches created by approx_count_distinct_state and computes the approximate count of distinct elements.";
+	static constexpr const char *Example = "approx_count_distinct_merge(approx_count_distinct_state(A))";
+
+	static AggregateFunction GetFunction();
+};
+
 struct ArgMinFun {
 	static constexpr const char *Name = "arg_min";
 	static constexpr const char *Parameters = "arg,val";
@@ -24,6 +24,24 @@ struct ApproxQuantileFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct ApproxQuantileStateFun {
+	static constexpr const char *Name = "approx_quantile_state";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Computes a T-Digest sketch of the values as a BLOB, which can be stored and merged by approx_quantile_merge.";
+	static constexpr const char *Example = "approx_quantile_state(x)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ApproxQuantileMergeFun {
+	static constexpr const char *Name = "approx_quantile_merge";
+	static constexpr const char *Parameters = "state,pos";
+	static constexpr const char *Description = "Merges the T-Digest sketches created by approx_quantile_state and computes the approximate quantile.";
+	static constexpr const char *Example = "approx_quantile_merge(approx_quantile_state(x), 0.5)";
+
+	static AggregateFunctionSet GetFunctions();
+};
+
 struct MadFun {
 	static constexpr const char *Name = "mad";
 	static constexpr const char *Parameters = "x";
@@ -93,4 +111,22 @@ struct ApproxTopKFun {
 	static AggregateFunction GetFunction();
 };
 
+struct ApproxTopKStateFun {
+	static constexpr const char *Name = "approx_top_k_state";
+	static constexpr const char *Parameters = "val,k";
+	static constexpr const char *Description = "Computes a sketch of the k approximately most occurring values as a BLOB, which can be stored and merged by approx_top_k_merge.";
+	static constexpr const char *Example = "approx_top_k_state(x, 5)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ApproxTopKMergeFun {
+	static constexpr const char *Name = "approx_top_k_merge";
+	static constexpr const char *Parameters = "state";
+	static constexpr const char *Description = "Merges the sketches created by approx_top_k_state and finds the k approximately most occurring values, as strings.";
+	static constexpr const char *Example = "approx_top_k_merge(approx_top_k_state(x, 5))";
+
+	static AggregateFunction GetFunction();
+};
+
 } // namespace duckdb
@@ -33,11 +33,22 @@ struct QuantileOperation {
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
 		if (source.v.empty()) {
 			return;
 		}
-		target.v.insert(target.v.end(), source.v.begin(), source.v.end());
+		if (aggr_input_data.combine_type != AggregateCombineType::ALLOW_DESTRUCTIVE) {
+			target.v.insert(target.v.end(), source.v.begin(), source.v.end());
+			return;
+		}
+		//	Destructive combines (e.g., of thread-local states) move the values instead of copying them:
+		//	always append the smaller vector to the larger one and release the memory of the source right away
+		auto &other = const_cast<STATE &>(source); // NOLINT: destructive combine explicitly allows destruction
+		if (target.v.size() < other.v.size()) {
+			std::swap(target.v, other.v);
+		}
+		target.v.insert(target.v.end(), other.v.begin(), other.v.end());
+		decltype(other.v)().swap(other.v);
 	}
 
 	template <class STATE>
@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/core_functions/aggregate/sketch_state.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+enum class SketchType : uint8_t { TDIGEST = 1, HYPERLOGLOG = 2, SPACE_SAVING = 3 };
+
+//! The states of the approximate aggregates (approx_quantile, approx_count_distinct, approx_top_k) can be exported
+//! as BLOBs by their *_state variants, stored, and later merged by their *_merge variants.
+//! A serialized sketch starts with a two byte header (the type of the sketch and the version of its format),
+//! followed by the payload of the sketch.
+struct SketchState {
+	static constexpr uint8_t VERSION = 1;
+
+	static void WriteHeader(MemoryStream &stream, SketchType type) {
+		stream.Write<uint8_t>(static_cast<uint8_t>(type));
+		stream.Write<uint8_t>(VERSION);
+	}
+
+	//! Returns a stream over the payload of a serialized sketch, after checking that it is of the expected type
+	static MemoryStream ReadHeader(const string_t &blob, SketchType type, const char *function_name) {
+		MemoryStream stream(data_ptr_cast(const_cast<char *>(blob.GetData())), blob.GetSize()); // NOLINT: read only
+		if (blob.GetSize() < 2 || stream.Read<uint8_t>() != static_cast<uint8_t>(type)) {
+			throw InvalidInputException("Invalid input for %s: not a state created by %s_state", function_name,
+			                            function_name);
+		}
+		auto version = stream.Read<uint8_t>();
+		if (version != VERSION) {
+			throw InvalidInputException("Invalid input for %s: unsupported state version %d", function_name,
+			                            static_cast<int>(version));
+		}
+		return stream;
+	}
+
+	static string_t AddBlob(Vector &result, MemoryStream &stream) {
+		return StringVector::AddStringOrBlob(result, const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+	}
+};
+
+} // namespace duckdb
@@ -87,6 +87,10 @@ public:
 	void ResetCount();
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
+	//! From now on, append every row as a new group without probing the HT (duplicates must be combined later)
+	void SkipLookups();
+	//! Whether rows are appended without probing the HT
+	bool SkipsLookups() const;
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
 
@@ -118,6 +122,23 @@ private:
 		DataChunk group_chunk;
 	} state;
 
+	//! Caches the groups of the entries of the dictionary of the last dictionary vector that was added
+	struct DictionaryState {
+		DictionaryState();
+
+		//! The id of the cached dictionary (0 if there is none)
+		idx_t dictionary_id;
+		//! The capacity of the arrays below
+		idx_t capacity;
+		//! The address of the aggregates of the group of every dictionary entry (if found)
+		unsafe_unique_array<data_ptr_t> dictionary_addresses;
+		unsafe_unique_array<bool> found_entry;
+		//! The dictionary entries that are looked up in the HT
+		SelectionVector unique_entries;
+		DataChunk unique_values;
+		Vector unique_addresses;
+	} dictionary_state;
+
 	//! The number of radix bits to partition by
 	idx_t radix_bits;
 	//! The data of the HT
@@ -128,6 +149,8 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether rows are appended without probing the HT
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -155,6 +178,12 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! Adds a chunk with a single dictionary vector group by looking up every dictionary entry only once
+	optional_idx TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
+	//! Updates the aggregates at the addresses of the append state
+	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
+	//! Invalidates the cached dictionary groups (because the pointer table was reset, or the data was moved)
+	void ResetDictionaryState();
 
 	//! Verify the pointer table of the HT
 	void Verify();
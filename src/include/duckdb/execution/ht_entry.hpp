@@ -99,4 +99,9 @@ inline void IncrementAndWrap(idx_t &offset, const uint64_t &capacity_mask) {
 	++offset &= capacity_mask;
 }
 
+// same as IncrementAndWrap, but leaves the bits above the capacity mask (e.g., the salt or partition) intact
+inline void IncrementAndWrapKeepUpperBits(idx_t &offset, const uint64_t &capacity_mask) {
+	offset = (offset & ~capacity_mask) | ((offset + 1) & capacity_mask);
+}
+
 } // namespace duckdb
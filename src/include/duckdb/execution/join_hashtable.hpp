@@ -143,8 +143,12 @@ public:
 		Vector salt_v;
 		Vector ht_offsets_v;
 		Vector ht_offsets_dense_v;
+		//! The gathered ht entries of the rows that are probed in the current iteration
+		Vector ht_entries_dense_v;
 
 		SelectionVector non_empty_sel;
+		//! The rows whose entry is occupied, but the salt does not match
+		SelectionVector salt_no_match_sel;
 	};
 
 	struct InsertState : SharedState {
@@ -167,8 +171,10 @@ public:
 	void Merge(JoinHashTable &other);
 	//! Combines the partitions in sink_collection into data_collection, as if it were not partitioned
 	void Unpartition();
-	//! Initialize the pointer table for the probe
-	void InitializePointerTable();
+	//! Initialize the pointer table for the probe. If partitioned is set, and the partitions of the data collection
+	//! are known and not too skewed, the pointer table is partitioned on the radix bits of the hashes, so that the
+	//! pointer table of each partition can be built independently (see PointerTableIsPartitioned)
+	void InitializePointerTable(bool partitioned = false);
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing.
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
@@ -236,6 +242,9 @@ public:
 
 	//! If there is more than one element in the chain, we need to scan the next elements of the chain
 	bool chains_longer_than_one;
+	//! Whether rows with keys that are already in the HT are inserted into the chain (not needed if we only need to
+	//! know whether a key exists, i.e., for SEMI, ANTI and MARK joins with only equality predicates)
+	bool insert_duplicate_keys;
 
 	//! The capacity of the HT. Is the same as hash_map.GetSize() / sizeof(ht_entry_t)
 	idx_t capacity = DConstants::INVALID_INDEX;
@@ -253,8 +262,13 @@ public:
 	bool finalized;
 	//! Whether or not any of the key elements contain NULL
 	bool has_null;
-	//! Bitmask for getting relevant bits from the hashes to determine the position
+	//! Bitmask for getting relevant bits from the hashes to determine the position (within the partition)
 	uint64_t bitmask = DConstants::INVALID_INDEX;
+	//! Bitmask for getting the radix bits from the hashes to determine the partition of the pointer table
+	//! (0 if the pointer table is not partitioned)
+	hash_t partition_mask = 0;
+	//! Shift that moves the radix bits of the hashes right above the bits of the position within the partition
+	idx_t partition_shift = 0;
 	//! Whether or not we error on multiple rows found per match in a SINGLE join
 	bool single_join_error_on_multiple_rows = true;
 
@@ -282,6 +296,27 @@ private:
 
 	bool UseSalt() const;
 
+public:
+	//! Gets the offset of a hash in the pointer table
+	inline idx_t GetPointerTableOffset(hash_t hash) const {
+		return ((hash & partition_mask) >> partition_shift) | (hash & bitmask);
+	}
+	//! Whether the pointer table is partitioned, i.e., the data of each partition of the data collection is inserted
+	//! into a separate part of the pointer table, and the partitions can be finalized without atomics
+	bool PointerTableIsPartitioned() const {
+		return partition_mask != 0;
+	}
+	//! The number of partitions of the data collection
+	idx_t PartitionCount() const {
+		D_ASSERT(!partition_chunk_offsets.empty());
+		return partition_chunk_offsets.size() - 1;
+	}
+	//! The index of the first chunk of the given partition in the data collection
+	idx_t PartitionChunkOffset(idx_t partition_idx) const {
+		return partition_chunk_offsets[partition_idx];
+	}
+
+private:
 	//! Gets a pointer to the entry in the HT for each of the hashes_v using linear probing. Will update the
 	//! key_match_sel vector and the count argument to the number and position of the matches
 	void GetRowPointers(DataChunk &keys, TupleDataChunkState &key_state, ProbeState &state, Vector &hashes_v,
@@ -302,6 +337,10 @@ private:
 	unique_ptr<PartitionedTupleData> sink_collection;
 	//! The DataCollection holding the main data of the hash table
 	unique_ptr<TupleDataCollection> data_collection;
+	//! The chunk offset of each partition in data_collection (if it was unpartitioned in one go), plus the chunk count
+	vector<idx_t> partition_chunk_offsets;
+	//! The count of the largest partition in data_collection (if it was unpartitioned in one go)
+	idx_t max_partition_count = 0;
 
 	//! The hash map of the HT, created after finalization
 	AllocatedData hash_map;
@@ -371,13 +410,10 @@ public:
 		return radix_bits;
 	}
 
-	idx_t GetPartitionStart() const {
-		return partition_start;
-	}
-
-	idx_t GetPartitionEnd() const {
-		return partition_end;
-	}
+	//! Number of partitions that are built in the current probe round
+	idx_t GetCurrentPartitionCount() const;
+	//! Number of partitions that are built in the current or in a previous probe round
+	idx_t GetCompletedPartitionCount() const;
 
 	//! Capacity of the pointer table given the ht count
 	//! (minimum of 1024 to prevent collision chance for small HT's)
@@ -415,9 +451,13 @@ private:
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
 
-	//! First and last partition of the current probe round
-	idx_t partition_start;
-	idx_t partition_end;
+	//! Partitions of the current probe round
+	ValidityMask current_partitions;
+	//! Partitions of the current and previous probe rounds
+	ValidityMask completed_partitions;
+
+	//! (Re-)initializes the partition masks for the current number of radix bits
+	void InitializePartitionMasks();
 };
 
 } // namespace duckdb
@@ -24,7 +24,8 @@ public:
 	unsafe_vector<idx_t> indices;
 	// The amount of radix_tables that are occupied
 	idx_t table_count;
-	//! Occupied tables, not equal to indices if aggregates share input data
+	//! For every table, the index of the first aggregate that uses it
+	//! Aggregates with identical input data share a table, which is only sunk into and scanned for that aggregate
 	vector<idx_t> table_indices;
 	//! This indirection is used to allow two aggregates to share the same input data
 	unordered_map<idx_t, idx_t> table_map;
@@ -36,6 +37,10 @@ public:
 	static unique_ptr<DistinctAggregateCollectionInfo> Create(vector<unique_ptr<Expression>> &aggregates);
 	const unsafe_vector<idx_t> &Indices() const;
 	bool AnyDistinct() const;
+	//! Whether the aggregate is the first aggregate that uses its table
+	bool OwnsTable(idx_t aggr_idx) const;
+	//! The (distinct) aggregates that use the table
+	unsafe_vector<idx_t> TableAggregates(idx_t table_idx) const;
 
 private:
 	//! Returns the amount of tables that are occupied
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parser/group_by_node.hpp"
@@ -15,6 +16,16 @@
 
 namespace duckdb {
 
+//! A Top-N (ORDER BY aggregate LIMIT n) that consumes the result of the aggregate
+struct AggregateTopN {
+	//! The aggregate that the Top-N orders on
+	idx_t aggregate_idx;
+	//! ASCENDING or DESCENDING
+	OrderType type;
+	//! The number of rows the Top-N keeps (limit + offset)
+	idx_t limit;
+};
+
 class GroupedAggregateData {
 public:
 	GroupedAggregateData() {
@@ -35,6 +46,8 @@ public:
 	//! Pointers to the aggregates
 	vector<BoundAggregateExpression *> bindings;
 	idx_t filter_count;
+	//! If set, the scan only has to emit the rows that can make it into this Top-N
+	unique_ptr<AggregateTopN> top_n;
 
 public:
 	idx_t GroupCount() const;
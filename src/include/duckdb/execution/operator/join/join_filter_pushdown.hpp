@@ -12,9 +12,12 @@
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/column_binding.hpp"
 
+#include <functional>
+
 namespace duckdb {
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -23,6 +26,11 @@ struct JoinFilterPushdownColumn {
 	idx_t join_condition;
 	//! The probe column index to which this filter should be applied
 	ColumnBinding probe_column_index;
+	//! Whether or not NULL values find a match (IS NOT DISTINCT FROM), in which case they can never be filtered out
+	bool null_values_are_equal = false;
+	//! If the probe column is compressed before the join (compressed materialization), the expression that
+	//! decompresses the build-side keys (on BoundReference 0) to the type of the probe column
+	unique_ptr<Expression> decompress_expression;
 };
 
 struct JoinFilterGlobalState {
@@ -40,12 +48,21 @@ struct JoinFilterLocalState {
 };
 
 struct JoinFilterPushdownInfo {
+	//! Build sides with at most this many rows push their exact keys as an IN-list (an OR of equality filters)
+	static constexpr const idx_t DYNAMIC_IN_FILTER_THRESHOLD = 16;
+	//! Build sides with at most this many rows push a Bloom filter over their keys (if the probe-side scan supports it)
+	static constexpr const idx_t DYNAMIC_BLOOM_FILTER_THRESHOLD = 4194304;
+
 	//! The dynamic table filter set where to push filters into
 	shared_ptr<DynamicTableFilterSet> dynamic_filters;
 	//! The filters that we should generate
 	vector<JoinFilterPushdownColumn> filters;
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
+	//! Whether or not the probe-side scan can evaluate Bloom filters
+	bool bloom_filter_pushdown = false;
+	//! Whether or not the filters should be inverted, i.e. only keep the rows that can NOT find a match (ANTI join)
+	bool inverted = false;
 
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
@@ -53,7 +70,26 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	//! Pushes the filters into the probe side, membership filters (IN-list or Bloom filter) are only generated if
+	//! push_membership_filters is set
+	void PushFilters(ClientContext &context, JoinHashTable &ht, JoinFilterGlobalState &gstate,
+	                 const PhysicalOperator &op, bool push_membership_filters = true) const;
+
+private:
+	//! Pushes a filter for the given column into the probe side
+	void PushFilter(const JoinFilterPushdownColumn &filter, unique_ptr<TableFilter> table_filter,
+	                const PhysicalOperator &op) const;
+	//! Scans the keys of the build side to push membership filters (IN-list or Bloom filter) for the given filters
+	void PushMembershipFilters(ClientContext &context, JoinHashTable &ht, const vector<idx_t> &filter_indexes,
+	                           const PhysicalOperator &op) const;
+	//! Pushes filters that only keep the probe-side rows that are guaranteed not to find a match in the build side
+	void PushInvertedFilters(ClientContext &context, JoinHashTable &ht, DataChunk &final_min_max,
+	                         const PhysicalOperator &op) const;
+	//! Scans the keys of the build side for the given filters (decompressed if required)
+	void ScanBuildKeys(ClientContext &context, JoinHashTable &ht, const vector<idx_t> &filter_indexes,
+	                   const std::function<void(DataChunk &keys)> &callback) const;
+	//! Gets the min or max value of a filter (decompressed if required)
+	Value GetMinMaxValue(ClientContext &context, DataChunk &final_min_max, idx_t aggr_idx) const;
 };
 
 } // namespace duckdb
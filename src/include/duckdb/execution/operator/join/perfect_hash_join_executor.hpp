@@ -20,13 +20,15 @@ class HashJoinGlobalSinkState;
 class PhysicalHashJoin;
 
 struct PerfectHashJoinStats {
-	Value build_min;
-	Value build_max;
-	Value probe_min;
-	Value probe_max;
+	//! The min/max of the build and probe side of each of the join keys
+	vector<Value> build_min;
+	vector<Value> build_max;
+	vector<Value> probe_min;
+	vector<Value> probe_max;
 	bool is_build_small = false;
 	bool is_build_dense = false;
 	bool is_probe_in_domain = false;
+	//! The size of the domain of the (combined) join keys minus one
 	idx_t build_range = 0;
 	idx_t estimated_cardinality = 0;
 };
@@ -44,21 +46,14 @@ public:
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context);
 	OperatorResultType ProbePerfectHashTable(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
 	                                         OperatorState &state);
-	bool BuildPerfectHashTable(LogicalType &type);
+	bool BuildPerfectHashTable();
 
 private:
-	void FillSelectionVectorSwitchProbe(Vector &source, SelectionVector &build_sel_vec, SelectionVector &probe_sel_vec,
-	                                    idx_t count, idx_t &probe_sel_count);
-	template <typename T>
-	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
-	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
-
-	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                    idx_t count);
-	template <typename T>
-	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
-	                                       idx_t count);
-	bool FullScanHashTable(LogicalType &key_type);
+	//! Selects the rows for which all keys are in the domain of the perfect hash table, and computes their offsets in
+	//! the perfect hash table. The keys are combined as a mixed-radix number (the first key varies the fastest)
+	idx_t SelectInDomain(const vector<reference<Vector>> &keys, idx_t count, SelectionVector &sel,
+	                     idx_t offsets[]) const;
+	bool FullScanHashTable();
 
 private:
 	const PhysicalHashJoin &join;
@@ -36,6 +36,9 @@ public:
 	// Projection mappings
 	vector<column_t> right_projection_map;
 
+	//	Whether LHS chunks that arrive in asof key order can be joined without buffering them
+	bool stream_ordered;
+
 public:
 	// Operator Interface
 	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
@@ -21,6 +21,10 @@ namespace duckdb {
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::HASH_JOIN;
+	//! The build side exceeds the probe side if it is at least this many times larger than the probe side estimate
+	static constexpr const idx_t BUILD_EXCEEDS_PROBE_FACTOR = 100;
+	//! ... and has at least this many rows
+	static constexpr const idx_t BUILD_EXCEEDS_PROBE_MINIMUM_COUNT = 100000;
 
 public:
 	PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
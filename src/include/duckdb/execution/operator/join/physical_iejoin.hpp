@@ -18,6 +18,10 @@ namespace duckdb {
 class PhysicalIEJoin : public PhysicalRangeJoin {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::IE_JOIN;
+	//! The number of range partitions of the sorted inputs per thread
+	static constexpr const idx_t PARTITIONS_PER_THREAD = 2;
+	//! The minimum number of rows of a range partition
+	static constexpr const idx_t MIN_PARTITION_SIZE = 65536;
 
 public:
 	PhysicalIEJoin(LogicalComparisonJoin &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
@@ -73,8 +73,9 @@ public:
 		void IntializeMatches();
 		void Print();
 
-		//! Starts the sorting process.
-		void Finalize(Pipeline &pipeline, Event &event);
+		//! Starts the sorting process. If the data needs to be merged, the merged blocks have at most
+		//! max_block_capacity rows
+		void Finalize(Pipeline &pipeline, Event &event, idx_t max_block_capacity = DConstants::INVALID_INDEX);
 		//! Schedules tasks to merge sort the current child's data during a Finalize phase
 		void ScheduleMergeTasks(Pipeline &pipeline, Event &event);
 
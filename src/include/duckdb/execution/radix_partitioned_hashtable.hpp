@@ -41,6 +41,9 @@ public:
 	          const unsafe_vector<idx_t> &filter) const;
 	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const;
 	void Finalize(ClientContext &context, GlobalSinkState &gstate) const;
+	//! Number of rows sunk, number of rows appended without pre-aggregation, and by how many threads
+	void GetSkippedLookups(GlobalSinkState &gstate, idx_t &sink_count, idx_t &skipped_count,
+	                       idx_t &skipped_threads) const;
 
 public:
 	//! Source interface
@@ -55,6 +58,8 @@ public:
 	const TupleDataLayout &GetLayout() const;
 	idx_t MaxThreads(GlobalSinkState &sink) const;
 	static void SetMultiScan(GlobalSinkState &sink);
+	//! Whether a Top-N on an aggregate of this type can be pushed into the scan (see AggregateTopN)
+	static bool SupportsTopN(const LogicalType &type);
 
 private:
 	void SetGroupingValues();
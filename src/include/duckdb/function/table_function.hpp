@@ -301,6 +301,9 @@ public:
 	//! Whether or not the table function can immediately prune out filter columns that are unused in the remainder of
 	//! the query plan, e.g., "SELECT i FROM tbl WHERE j = 42;" - j does not need to leave the table function at all
 	bool filter_prune;
+	//! Whether or not the table function can evaluate Bloom filters (BLOOM_FILTER table filters). These are only pushed
+	//! down at runtime, e.g., from the build side of a hash join into the probe side scan
+	bool bloom_filter_pushdown;
 	//! Additional function info, passed to the bind
 	shared_ptr<TableFunctionInfo> function_info;
 
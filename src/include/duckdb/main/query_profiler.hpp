@@ -134,6 +134,8 @@ public:
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
 	//! Adds the top level query information to the global profiler.
 	DUCKDB_API void SetInfo(const double &blocked_thread_time);
+	//! Adds information that is only known at runtime to the extra info of an operator (if enabled)
+	DUCKDB_API void AddExtraInfo(const PhysicalOperator &phys_op, const string &key, const string &value);
 
 	DUCKDB_API void StartPhase(MetricsType phase_metric);
 	DUCKDB_API void EndPhase();
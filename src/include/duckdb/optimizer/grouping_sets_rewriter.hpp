@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/grouping_sets_rewriter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+
+namespace duckdb {
+
+class BoundAggregateExpression;
+class LogicalAggregate;
+class Optimizer;
+
+//! The GroupingSetsRewriter computes GROUPING SETS/ROLLUP/CUBE from a single aggregation of the input.
+//! Instead of aggregating the input once for every grouping set, the input is aggregated once on the finest grouping
+//! set, and the grouping sets are computed by re-aggregating that (usually much smaller) result.
+//! This is only done if all aggregates can be re-aggregated (SUM, COUNT, MIN, MAX)
+class GroupingSetsRewriter {
+public:
+	explicit GroupingSetsRewriter(Optimizer &optimizer);
+
+public:
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	unique_ptr<LogicalOperator> Rewrite(unique_ptr<LogicalOperator> op);
+	//! Whether the aggregate has multiple grouping sets that can be computed from its finest grouping set
+	static bool CanRewrite(const LogicalAggregate &aggr);
+	//! Re-aggregates the finest grouping set, computed by the aggregate below, into all grouping sets
+	unique_ptr<LogicalOperator> RewriteAggregate(unique_ptr<LogicalOperator> op);
+	//! Binds the aggregate that re-aggregates the result of "aggr", which has the given binding
+	unique_ptr<Expression> BindReaggregate(const BoundAggregateExpression &aggr, ColumnBinding binding);
+
+private:
+	Optimizer &optimizer;
+	//! Updates the bindings of the rewritten aggregates in the rest of the plan
+	ColumnBindingReplacer replacer;
+};
+
+} // namespace duckdb
@@ -0,0 +1,39 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/blocked_bloom_filter.hpp"
+
+namespace duckdb {
+
+//! The BloomFilter is a probabilistic filter: it removes (most) values that are not contained in the filter, but can
+//! let through values that are not contained in it. It should only be pushed into scans as a pre-filter of an operator
+//! that verifies the remaining rows anyway (e.g. the probe side of a hash join).
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	explicit BloomFilter(shared_ptr<BlockedBloomFilter> filter);
+
+	//! The Bloom filter over the hashes of the values that can pass (shared between copies of the filter)
+	shared_ptr<BlockedBloomFilter> filter;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -28,7 +28,8 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6 // probabilistic membership test (e.g. generated from the build side of a hash join)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -418,6 +418,22 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	profiler.timings.clear();
 }
 
+void QueryProfiler::AddExtraInfo(const PhysicalOperator &phys_op, const string &key, const string &value) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(phys_op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	auto &info = entry->second.get().GetProfilingInfo();
+	if (!info.Enabled(MetricsType::EXTRA_INFO)) {
+		return;
+	}
+	info.extra_info[key] = value;
+}
+
 void QueryProfiler::SetInfo(const double &blocked_thread_time) {
 	lock_guard<mutex> guard(flush_lock);
 	if (!IsEnabled() || !running || !root->GetProfilingInfo().Enabled(MetricsType::BLOCKED_THREAD_TIME)) {
@@ -0,0 +1,178 @@
+#include "duckdb/optimizer/grouping_sets_rewriter.hpp"
+
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+GroupingSetsRewriter::GroupingSetsRewriter(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> GroupingSetsRewriter::Optimize(unique_ptr<LogicalOperator> op) {
+	op = Rewrite(std::move(op));
+	if (!replacer.replacement_bindings.empty()) {
+		// Make the plan consistent again
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+unique_ptr<LogicalOperator> GroupingSetsRewriter::Rewrite(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = Rewrite(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY && CanRewrite(op->Cast<LogicalAggregate>())) {
+		return RewriteAggregate(std::move(op));
+	}
+	return op;
+}
+
+//! Returns the name of the aggregate function that combines the results of "aggr", or an empty string if there is none
+static string GetReaggregateName(const BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.order_bys) {
+		return string();
+	}
+	const auto &name = aggr.function.name;
+	if (name == "sum" || name == "min" || name == "max") {
+		if (aggr.return_type.id() == LogicalTypeId::VARCHAR && !StringType::GetCollation(aggr.return_type).empty()) {
+			return string();
+		}
+		return name;
+	}
+	if (name == "count" || name == "count_star") {
+		return "sum";
+	}
+	return string();
+}
+
+bool GroupingSetsRewriter::CanRewrite(const LogicalAggregate &aggr) {
+	if (aggr.grouping_sets.size() <= 1) {
+		return false;
+	}
+	// The finest grouping set, which is computed from the input, has to be one of the grouping sets
+	bool has_finest_grouping_set = false;
+	for (auto &grouping_set : aggr.grouping_sets) {
+		if (grouping_set.size() == aggr.groups.size()) {
+			has_finest_grouping_set = true;
+		}
+	}
+	if (!has_finest_grouping_set) {
+		return false;
+	}
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE ||
+		    GetReaggregateName(expr->Cast<BoundAggregateExpression>()).empty()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+unique_ptr<Expression> GroupingSetsRewriter::BindReaggregate(const BoundAggregateExpression &aggr,
+                                                             ColumnBinding binding) {
+	auto &context = optimizer.context;
+	const auto name = GetReaggregateName(aggr);
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(context, SYSTEM_CATALOG, DEFAULT_SCHEMA, name);
+
+	vector<unique_ptr<Expression>> children;
+	children.push_back(make_uniq<BoundColumnRefExpression>(aggr.return_type, binding));
+
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	auto best_function = function_binder.BindFunction(func.name, func.functions, {aggr.return_type}, error);
+	if (!best_function.IsValid()) {
+		throw InternalException("Could not re-aggregate \"%s\" in GroupingSetsRewriter", aggr.ToString());
+	}
+	auto bound_function = func.functions.GetFunctionByOffset(best_function.GetIndex());
+	return function_binder.BindAggregateFunction(bound_function, std::move(children), nullptr,
+	                                             AggregateType::NON_DISTINCT);
+}
+
+unique_ptr<LogicalOperator> GroupingSetsRewriter::RewriteAggregate(unique_ptr<LogicalOperator> op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	auto &binder = optimizer.binder;
+
+	// The aggregate at the bottom computes the finest grouping set from the input
+	auto finest = make_uniq<LogicalAggregate>(binder.GenerateTableIndex(), binder.GenerateTableIndex(),
+	                                          std::move(aggr.expressions));
+	finest->groups = std::move(aggr.groups);
+	finest->group_stats = std::move(aggr.group_stats);
+	GroupingSet all_groups;
+	for (idx_t group_idx = 0; group_idx < finest->groups.size(); group_idx++) {
+		all_groups.insert(group_idx);
+	}
+	finest->grouping_sets.push_back(std::move(all_groups));
+	finest->children = std::move(aggr.children);
+
+	// The aggregate in the middle re-aggregates it into the grouping sets
+	vector<unique_ptr<Expression>> reaggregates;
+	for (idx_t aggr_idx = 0; aggr_idx < finest->expressions.size(); aggr_idx++) {
+		auto &finest_aggr = finest->expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		reaggregates.push_back(BindReaggregate(finest_aggr, ColumnBinding(finest->aggregate_index, aggr_idx)));
+	}
+	auto grouping_sets = make_uniq<LogicalAggregate>(binder.GenerateTableIndex(), binder.GenerateTableIndex(),
+	                                                 std::move(reaggregates));
+	for (idx_t group_idx = 0; group_idx < finest->groups.size(); group_idx++) {
+		grouping_sets->groups.push_back(make_uniq<BoundColumnRefExpression>(
+		    finest->groups[group_idx]->return_type, ColumnBinding(finest->group_index, group_idx)));
+	}
+	grouping_sets->grouping_sets = std::move(aggr.grouping_sets);
+	grouping_sets->grouping_functions = std::move(aggr.grouping_functions);
+	if (!grouping_sets->grouping_functions.empty()) {
+		grouping_sets->groupings_index = binder.GenerateTableIndex();
+	}
+
+	// The projection on top restores the results (and types) of the original aggregates
+	const auto projection_index = binder.GenerateTableIndex();
+	vector<unique_ptr<Expression>> select_list;
+	for (idx_t group_idx = 0; group_idx < grouping_sets->groups.size(); group_idx++) {
+		auto &group = *grouping_sets->groups[group_idx];
+		select_list.push_back(
+		    make_uniq<BoundColumnRefExpression>(group.return_type, ColumnBinding(grouping_sets->group_index, group_idx)));
+		replacer.replacement_bindings.emplace_back(ColumnBinding(aggr.group_index, group_idx),
+		                                           ColumnBinding(projection_index, select_list.size() - 1));
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < grouping_sets->expressions.size(); aggr_idx++) {
+		auto &original = finest->expressions[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto &reaggregate = *grouping_sets->expressions[aggr_idx];
+		unique_ptr<Expression> result = make_uniq<BoundColumnRefExpression>(
+		    reaggregate.return_type, ColumnBinding(grouping_sets->aggregate_index, aggr_idx));
+		result = BoundCastExpression::AddCastToType(optimizer.context, std::move(result), original.return_type);
+		if (original.function.name == "count" || original.function.name == "count_star") {
+			// The count of an empty grouping set is 0, not NULL
+			auto coalesce = make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_COALESCE, original.return_type);
+			coalesce->children.push_back(std::move(result));
+			coalesce->children.push_back(make_uniq<BoundConstantExpression>(Value::BIGINT(0)));
+			result = std::move(coalesce);
+		}
+		select_list.push_back(std::move(result));
+		replacer.replacement_bindings.emplace_back(ColumnBinding(aggr.aggregate_index, aggr_idx),
+		                                           ColumnBinding(projection_index, select_list.size() - 1));
+	}
+	for (idx_t grouping_idx = 0; grouping_idx < grouping_sets->grouping_functions.size(); grouping_idx++) {
+		select_list.push_back(make_uniq<BoundColumnRefExpression>(
+		    LogicalType::BIGINT, ColumnBinding(grouping_sets->groupings_index, grouping_idx)));
+		replacer.replacement_bindings.emplace_back(ColumnBinding(aggr.groupings_index, grouping_idx),
+		                                           ColumnBinding(projection_index, select_list.size() - 1));
+	}
+
+	grouping_sets->children.push_back(std::move(finest));
+	auto projection = make_uniq<LogicalProjection>(projection_index, std::move(select_list));
+	projection->children.push_back(std::move(grouping_sets));
+	if (op->has_estimated_cardinality) {
+		projection->SetEstimatedCardinality(op->estimated_cardinality);
+		projection->children[0]->SetEstimatedCardinality(op->estimated_cardinality);
+	}
+	return std::move(projection);
+}
+
+} // namespace duckdb
@@ -9,27 +9,64 @@
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/function/scalar/compressed_materialization_functions.hpp"
 
 namespace duckdb {
 
 JoinFilterPushdownOptimizer::JoinFilterPushdownOptimizer(Optimizer &optimizer) : optimizer(optimizer) {
 }
 
+//! If the expression compresses a column (compressed materialization), returns the expression that decompresses it
+static unique_ptr<Expression> GetDecompressExpression(const Expression &expr) {
+	if (expr.type != ExpressionType::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.children.empty() || func.children[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &compressed_type = func.return_type;
+	auto &decompressed_type = func.children[0]->return_type;
+	vector<unique_ptr<Expression>> arguments;
+	arguments.push_back(make_uniq<BoundReferenceExpression>(compressed_type, 0));
+	if (StringUtil::StartsWith(func.function.name, "__internal_compress_integral_")) {
+		// integral compression subtracts the minimum - which we need to add back
+		arguments.push_back(func.children[1]->Copy());
+		auto decompress_function = CMIntegralDecompressFun::GetFunction(compressed_type, decompressed_type);
+		return make_uniq<BoundFunctionExpression>(decompressed_type, std::move(decompress_function),
+		                                          std::move(arguments), nullptr);
+	}
+	if (StringUtil::StartsWith(func.function.name, "__internal_compress_string_")) {
+		auto decompress_function = CMStringDecompressFun::GetFunction(compressed_type);
+		return make_uniq<BoundFunctionExpression>(decompressed_type, std::move(decompress_function),
+		                                          std::move(arguments), nullptr);
+	}
+	return nullptr;
+}
+
 void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &join) {
+	bool inverted = false;
 	switch (join.join_type) {
 	case JoinType::MARK:
 	case JoinType::SINGLE:
 	case JoinType::LEFT:
 	case JoinType::OUTER:
-	case JoinType::ANTI:
-	case JoinType::RIGHT_ANTI:
-	case JoinType::RIGHT_SEMI:
 		// cannot generate join filters for these join types
 		// mark/single - cannot change cardinality of probe side
 		// left/outer always need to include every row from probe side
-		// FIXME: anti/right_anti - we could do this, but need to invert the join conditions
 		return;
+	case JoinType::ANTI:
+		// anti - we can only remove probe-side rows that are guaranteed to find a match, i.e. we invert the filters
+		// this is only correct if a match on the filtered column implies a match on the entire join condition
+		if (join.conditions.size() != 1) {
+			return;
+		}
+		inverted = true;
+		break;
 	default:
+		// right_semi/right_anti only emit build-side rows - probe-side rows without a match can be removed
 		break;
 	}
 	// re-order conditions here - otherwise this will happen later on and invalidate the indexes we generate
@@ -37,8 +74,9 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 	auto pushdown_info = make_uniq<JoinFilterPushdownInfo>();
 	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
 		auto &cond = join.conditions[cond_idx];
-		if (cond.comparison != ExpressionType::COMPARE_EQUAL) {
-			// only equality supported for now
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL &&
+		    cond.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			// only equality (and IS NOT DISTINCT FROM) supported for now
 			continue;
 		}
 		if (cond.left->type != ExpressionType::BOUND_COLUMN_REF) {
@@ -53,12 +91,18 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 			// interval is not supported for pushdown
 			continue;
 		}
+		auto key_type = cond.left->return_type.InternalType();
+		if (inverted && (key_type == PhysicalType::FLOAT || key_type == PhysicalType::DOUBLE)) {
+			// inverted filters need exact equality semantics - which floating point comparisons (NaN, -0) do not have
+			continue;
+		}
 		JoinFilterPushdownColumn pushdown_col;
 		pushdown_col.join_condition = cond_idx;
+		pushdown_col.null_values_are_equal = cond.comparison == ExpressionType::COMPARE_NOT_DISTINCT_FROM;
 
 		auto &colref = cond.left->Cast<BoundColumnRefExpression>();
 		pushdown_col.probe_column_index = colref.binding;
-		pushdown_info->filters.push_back(pushdown_col);
+		pushdown_info->filters.push_back(std::move(pushdown_col));
 	}
 	if (pushdown_info->filters.empty()) {
 		// could not generate any filters - bail-out
@@ -70,11 +114,26 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		auto &probe_child = probe_source.get();
 		switch (probe_child.type) {
 		case LogicalOperatorType::LOGICAL_LIMIT:
-		case LogicalOperatorType::LOGICAL_FILTER:
-		case LogicalOperatorType::LOGICAL_ORDER_BY:
 		case LogicalOperatorType::LOGICAL_TOP_N:
 		case LogicalOperatorType::LOGICAL_DISTINCT:
-		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+			if (inverted) {
+				// removing rows below these operators can change which rows they emit - and those rows might not
+				// have a match
+				return;
+			}
+			probe_source = *probe_child.children[0];
+			break;
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN: {
+			auto child_join_type = probe_child.Cast<LogicalComparisonJoin>().join_type;
+			if (inverted && (child_join_type == JoinType::RIGHT || child_join_type == JoinType::OUTER)) {
+				// removing rows from the left side of these joins can introduce NULL rows - which never find a match
+				return;
+			}
+			probe_source = *probe_child.children[0];
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
 		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
 			// does not affect probe side - continue into left child
 			// FIXME: we can probably recurse into more operators here (e.g. window, set operation, unnest)
@@ -88,13 +147,20 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 					// index does not belong to this projection - bail-out
 					return;
 				}
-				auto &expr = *proj.expressions[filter.probe_column_index.column_index];
-				if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				reference<Expression> expr = *proj.expressions[filter.probe_column_index.column_index];
+				if (!filter.decompress_expression) {
+					// the column might be compressed (compressed materialization) - look through the compression
+					filter.decompress_expression = GetDecompressExpression(expr.get());
+					if (filter.decompress_expression) {
+						expr = *expr.get().Cast<BoundFunctionExpression>().children[0];
+					}
+				}
+				if (expr.get().type != ExpressionType::BOUND_COLUMN_REF) {
 					// not a simple column ref - bail-out
 					return;
 				}
 				// column-ref - pass through the new column binding
-				auto &colref = expr.Cast<BoundColumnRefExpression>();
+				auto &colref = expr.get().Cast<BoundColumnRefExpression>();
 				filter.probe_column_index = colref.binding;
 			}
 			probe_source = *probe_child.children[0];
@@ -123,6 +189,8 @@ void JoinFilterPushdownOptimizer::GenerateJoinFilters(LogicalComparisonJoin &joi
 		get.dynamic_filters = make_shared_ptr<DynamicTableFilterSet>();
 	}
 	pushdown_info->dynamic_filters = get.dynamic_filters;
+	pushdown_info->bloom_filter_pushdown = get.function.bloom_filter_pushdown;
+	pushdown_info->inverted = inverted;
 
 	// set up the min/max aggregates for each of the filters
 	vector<AggregateFunction> aggr_functions;
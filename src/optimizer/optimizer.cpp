@@ -13,6 +13,7 @@
 #include "duckdb/optimizer/expression_heuristics.hpp"
 #include "duckdb/optimizer/filter_pullup.hpp"
 #include "duckdb/optimizer/filter_pushdown.hpp"
+#include "duckdb/optimizer/grouping_sets_rewriter.hpp"
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/limit_pushdown.hpp"
@@ -164,6 +165,12 @@ void Optimizer::RunBuiltInOptimizers() {
 		remove.VisitOperator(*plan);
 	});
 
+	// compute the grouping sets of GROUPING SETS/ROLLUP/CUBE from a single aggregation of the input
+	RunOptimizer(OptimizerType::GROUPING_SETS, [&]() {
+		GroupingSetsRewriter grouping_sets_rewriter(*this);
+		plan = grouping_sets_rewriter.Optimize(std::move(plan));
+	});
+
 	// then we extract common subexpressions inside the different operators
 	RunOptimizer(OptimizerType::COMMON_SUBEXPRESSIONS, [&]() {
 		CommonSubExpressionOptimizer cse_optimizer(binder);
@@ -0,0 +1,52 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(shared_ptr<BlockedBloomFilter> filter_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter(std::move(filter_p)) {
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// min/max statistics cannot be compared against a set of hashes
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter == filter;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the Bloom filter only serves to reduce the amount of rows - every row is verified by its consumer anyway
+	// not filtering at all is therefore a valid (if less selective) expression of this filter
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteObject(200, "filter", [&](Serializer &obj) { filter->Serialize(obj); });
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	shared_ptr<BlockedBloomFilter> filter;
+	deserializer.ReadObject(200, "filter",
+	                        [&](Deserializer &obj) { filter = BlockedBloomFilter::Deserialize(obj); });
+	return make_uniq<BloomFilter>(std::move(filter));
+}
+
+} // namespace duckdb
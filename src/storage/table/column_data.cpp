@@ -348,7 +348,10 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	FilterPropagateResult prune_result;
 	{
 		lock_guard<mutex> l(stats_lock);
-		prune_result = filter.CheckStatistics(state.current->stats.statistics);
+		// the statistics of a segment do not track NULL values - these are kept in the validity column
+		auto segment_stats = state.current->stats.statistics.Copy();
+		segment_stats.Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		prune_result = filter.CheckStatistics(segment_stats);
 		if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
 			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 		}
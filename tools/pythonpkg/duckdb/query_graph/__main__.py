@@ -113,6 +113,7 @@ color_map = {
     "FILTER": "#bae1ff",
     "ORDER_BY": "#facd60",
     "PERFECT_HASH_GROUP_BY": "#ffffba",
+    "STREAMING_GROUP_BY": "#ffffba",
     "HASH_GROUP_BY": "#ffffba",
     "NESTED_LOOP_JOIN": "#ffffba",
     "STREAMING_LIMIT": "#facd60",